@@ -1,18 +1,31 @@
 #pragma once
 
+#include <Graphs/DegreeTable.hpp>
 #include <Graphs/Graph.hpp>
 #include <Graphs/Pixel_map.hpp>
 #include <map>
+#include <memory_resource>
+#include <span>
 #include <string>
 
 namespace Graphs
 {
+/*
+        Removing a node drops its list and tombstones its id. The arcs
+        pointing back to it stay in the lists of its neighbors, only their
+        degrees drop, so a removal costs O(deg log deg) for graphs stored with
+        both arc directions. Arcs into removed nodes are hidden from
+        getNeighborsOf and purged by compact(), which also settles the
+        degrees of one-way arcs into removed nodes.
+        Neighbor lists live in a pool over the given upstream resource and
+        batch updates take their scratch space from a per-call arena.
+*/
 class AdjList : public Graph
 {
     public:
-    AdjList(std::string);
+    AdjList(std::string, std::pmr::memory_resource* = std::pmr::get_default_resource());
 
-    AdjList(const Graph&);
+    AdjList(const Graph&, std::pmr::memory_resource* = std::pmr::get_default_resource());
     // AdjList(const Data::Pixel_map&);
 
     AdjList(AdjList&) = delete;
@@ -26,22 +39,36 @@ class AdjList : public Graph
     void addNodes(uint32_t) override;
     void removeNode(NodeId) override;
     void removeEdge(const EdgeInfo&) override;
+    void setEdges(std::span<const EdgeInfo>) override;
+    void removeEdges(std::span<const EdgeInfo>) override;
 
     virtual std::vector<NodeId> getNodeIds() const override;
     virtual std::vector<NodeId> getNeighborsOf(NodeId) const override;
 
+    std::span<const uint32_t> degrees() const;
+    uint32_t maxDegree() const;
+
+    void compact();
+
     virtual ~AdjList() = default;
 
     private:
     std::string show() const override;
 
-    using Neighbors = std::vector<uint32_t>;
+    using Neighbors = std::pmr::vector<uint32_t>;
 
     void buildFromLstFile(const std::string&);
+    void rebuildDegrees();
     void removeNeighborFromRange(Neighbors&, NodeId);
-    void addNeighborAndSortRange(Neighbors&, NodeId);
+    void addNeighborToSortedRange(Neighbors&, NodeId);
+    uint32_t liveDegree(const Neighbors&) const;
 
-    std::vector<Neighbors> nodes;
+    // declared first, so it outlives the lists allocated from it
+    std::pmr::unsynchronized_pool_resource neighborPool;
+    std::pmr::vector<Neighbors> nodes{&neighborPool};
     std::map<NodeId, uint32_t> nodeMap;
+    DegreeTable degreeTable;
+    std::vector<bool> removedIds;
+    uint32_t pendingRemovals = 0;
 };
 } // namespace Graphs
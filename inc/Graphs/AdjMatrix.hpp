@@ -1,7 +1,11 @@
 #pragma once
 
 #include <cstdint>
+#include <Graphs/DegreeTable.hpp>
 #include <Graphs/Graph.hpp>
+#include <limits>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -13,11 +17,18 @@ void generate_throughtput(std::string input_file_path, std::string output_file_p
 
 namespace Graphs
 {
+/*
+        Removed nodes leave a tombstoned row and column behind, so removal
+        costs a single row and column scan. compact() drops the tombstones
+        in one pass over the matrix. Node ids stay stable across both and
+        ids of removed nodes are never reused.
+        Rows are allocated from the given memory resource.
+*/
 class AdjMatrix : public Graph
 {
     public:
-    AdjMatrix(std::string);
-    AdjMatrix(const Graph&);
+    AdjMatrix(std::string, std::pmr::memory_resource* = std::pmr::get_default_resource());
+    AdjMatrix(const Graph&, std::pmr::memory_resource* = std::pmr::get_default_resource());
 
     AdjMatrix(AdjMatrix&) = delete;
     AdjMatrix(AdjMatrix&&) = delete;
@@ -33,17 +44,31 @@ class AdjMatrix : public Graph
     std::vector<NodeId> getNodeIds() const override;
     std::vector<NodeId> getNeighborsOf(NodeId) const override;
 
+    std::span<const uint32_t> degrees() const;
+    uint32_t maxDegree() const;
+
+    void compact();
+
     virtual ~AdjMatrix() = default;
 
     private:
+    using Row = std::pmr::vector<uint32_t>;
+
     std::string show() const override;
     void buildFromMatFile(const std::string&);
     void buildFromGraphMLFile(const std::string&);
     void resizeMatrixToFitNodes(uint32_t);
+    void rebuildDegrees();
+    void appendRow(Row);
+    uint32_t rowOf(NodeId) const;
+
+    static constexpr uint32_t removed = std::numeric_limits<uint32_t>::max();
 
-    std::map<NodeId, uint32_t> nodeIndexMapping;
+    std::vector<uint32_t> nodeRows;
+    std::vector<NodeId> rowNodes;
+    uint32_t tombstones = 0;
 
-    using Row = std::vector<uint32_t>;
-    std::vector<Row> matrix;
+    std::pmr::vector<Row> matrix;
+    DegreeTable degreeTable;
 };
 } // namespace Graphs
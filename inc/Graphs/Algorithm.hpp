@@ -1,5 +1,6 @@
 #pragma once
 
+#include <concepts>
 #include <Graphs/Graph.hpp>
 
 namespace Graphs::Algorithm
@@ -20,4 +21,16 @@ using NotVerbose = Verbose<not isVerbose, T>;
 
 constexpr bool verbose = true;
 constexpr bool notVerbose = false;
+
+/*
+        Backends with dense node ids in [0, nodesAmount()) that expose their
+        rows through forEachNeighbor. Algorithms templated on such a type
+        iterate its storage directly, without a virtual call per node and a
+        copied neighbor list per call.
+*/
+template <class GraphType>
+concept StaticGraph = std::derived_from<GraphType, Graph> and requires(const GraphType& graph, NodeId node) {
+    { graph.nodesAmount() } -> std::convertible_to<uint32_t>;
+    graph.forEachNeighbor(node, [](NodeId) {});
+};
 } // namespace Graphs::Algorithm
@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <fstream>
 #include <Graphs/Graph.hpp>
+#include <optional>
+#include <string>
 
 namespace Graphs
 {
@@ -30,14 +32,88 @@ class Benchmark
              uint16_t iterations,
              Mode mode,
              bool bench_log,
-             bool alg_log);
+             bool alg_log,
+             std::optional<uint32_t> chromatic_number = std::nullopt);
     void color_benchmark(Graphs::Graph& graph,
                          std::string identifier,
                          uint16_t iterations,
                          std::fstream& file,
                          bool bench_log,
-                         bool alg_log);
+                         bool alg_log,
+                         std::optional<uint32_t> chromatic_number = std::nullopt);
+    void run_edge_coloring(Graphs::Graph& graph,
+                           std::string identifier,
+                           std::string file_path,
+                           uint16_t iterations,
+                           Mode mode,
+                           bool bench_log);
+    void edge_color_benchmark(Graphs::Graph& graph,
+                              std::string identifier,
+                              uint16_t iterations,
+                              std::fstream& file,
+                              bool bench_log);
+    void run_bfs(Graphs::Graph& graph,
+                 std::string identifier,
+                 std::string file_path,
+                 uint16_t iterations,
+                 Mode mode,
+                 bool bench_log,
+                 uint32_t threads_count = 0);
+    void bfs_benchmark(Graphs::Graph& graph,
+                       std::string identifier,
+                       uint16_t iterations,
+                       std::fstream& file,
+                       bool bench_log,
+                       uint32_t threads_count = 0);
+    void run_reordering(Graphs::Graph& graph,
+                        std::string identifier,
+                        std::string file_path,
+                        uint16_t iterations,
+                        Mode mode,
+                        bool bench_log);
+    void reordering_benchmark(Graphs::Graph& graph,
+                              std::string identifier,
+                              uint16_t iterations,
+                              std::fstream& file,
+                              bool bench_log);
+    void run_max_flow(std::string samples_directory,
+                      std::string file_path,
+                      uint16_t iterations,
+                      Mode mode,
+                      bool bench_log);
+    void max_flow_benchmark(Graphs::Graph& graph,
+                            std::string identifier,
+                            uint16_t iterations,
+                            std::fstream& file,
+                            bool bench_log);
+    void run_dispatch(Graphs::Graph& graph,
+                      std::string identifier,
+                      std::string file_path,
+                      uint16_t iterations,
+                      Mode mode,
+                      bool bench_log);
+    void dispatch_benchmark(Graphs::Graph& graph,
+                            std::string identifier,
+                            uint16_t iterations,
+                            std::fstream& file,
+                            bool bench_log);
+    void run_placement(std::string graph_path,
+                       std::string identifier,
+                       std::string file_path,
+                       uint16_t iterations,
+                       Mode mode,
+                       bool bench_log,
+                       uint32_t threads_count = 0);
+    void placement_benchmark(std::string graph_path,
+                             std::string identifier,
+                             uint16_t iterations,
+                             std::fstream& file,
+                             bool bench_log,
+                             uint32_t threads_count = 0);
 
     ~Benchmark() {}
+
+    private:
+    std::fstream open_file(const std::string& file_path, Mode mode) const;
 };
 } // namespace Graph
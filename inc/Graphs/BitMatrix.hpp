@@ -0,0 +1,59 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Square matrix of bits stored row by row in 64-bit words, so the
+        intersection of two rows is a word-wise AND. Takes n^2 / 8 bytes.
+*/
+class BitMatrix
+{
+    public:
+    BitMatrix(uint32_t size) : rowWords((static_cast<std::size_t>(size) + 63) / 64), words(rowWords * size, 0) {}
+
+    void set(uint32_t row, uint32_t column) {
+        words[row * rowWords + column / 64] |= uint64_t{1} << (column % 64);
+    }
+
+    /* Resizes to size x size with every bit cleared, keeping the allocated storage */
+    void reset(uint32_t size) {
+        rowWords = (static_cast<std::size_t>(size) + 63) / 64;
+        words.assign(rowWords * size, 0);
+    }
+
+    bool test(uint32_t row, uint32_t column) const {
+        return (words[row * rowWords + column / 64] >> (column % 64)) & 1;
+    }
+
+    std::span<const uint64_t> row(uint32_t row) const {
+        return {words.data() + row * rowWords, rowWords};
+    }
+
+    /* Calls visitor(column) for every column set in both rows */
+    template <class Visitor>
+    void forEachCommon(uint32_t lhs, uint32_t rhs, Visitor visitor) const {
+        auto lhsRow = row(lhs);
+        auto rhsRow = row(rhs);
+        for (std::size_t i = 0; i < rowWords; i++)
+        {
+            for (auto common = lhsRow[i] & rhsRow[i]; common != 0; common &= common - 1)
+            {
+                visitor(static_cast<uint32_t>(i * 64 + std::countr_zero(common)));
+            }
+        }
+    }
+
+    std::size_t memoryUsage() const {
+        return words.capacity() * sizeof(uint64_t);
+    }
+
+    private:
+    std::size_t rowWords;
+    std::vector<uint64_t> words;
+};
+} // namespace Graphs
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Levels and parents of the BFS tree indexed by node id. Nodes that were
+        not reached (and ids not present in the graph) have level unreached
+        and parent noParent, the source is its own parent.
+*/
+struct BfsResult
+{
+    static constexpr uint32_t unreached = std::numeric_limits<uint32_t>::max();
+    static constexpr NodeId noParent = std::numeric_limits<NodeId>::max();
+
+    std::vector<uint32_t> levels;
+    std::vector<NodeId> parents;
+
+    bool reached(NodeId node) const {
+        return node < levels.size() and levels[node] != unreached;
+    }
+};
+
+/*
+        Breadth-first search along outgoing edges. Method::queue is the
+        single-threaded textbook traversal. Method::directionOptimizing keeps
+        the frontier both as a queue and as a bitmap, and switches between
+        parallel top-down steps (frontier nodes claim their neighbors) and
+        bottom-up steps (unvisited nodes look for a parent in the frontier)
+        with the heuristic of Beamer et al.: bottom-up once the frontier
+        has more edges than unexplored nodes / alpha, and back to top-down
+        once it shrinks below nodes / beta. Bottom-up steps scan incoming
+        edges, so unless the graph is symmetric (checked, or declared with
+        the symmetricKey metadata) a transposed copy is built first.
+        Parents may differ between the methods, levels are always the same.
+        A CompressedGraph is traversed in place by Method::queue, and
+        decompressed to CSR first by Method::directionOptimizing.
+*/
+class BreadthFirstSearch : public AlgorithmFunctor
+{
+    public:
+    enum class Method
+    {
+        queue = 0,
+        directionOptimizing
+    };
+
+    BreadthFirstSearch(std::shared_ptr<BfsResult> resultContainer,
+                       NodeId source,
+                       Method method = Method::queue,
+                       uint32_t threadsCount = 0)
+        : result(std::move(resultContainer)), source(source), method(method), threadsCount(threadsCount) {
+        if (not result)
+        {
+            throw std::invalid_argument{"BFS result cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    static constexpr uint32_t alpha = 14;
+    static constexpr uint32_t beta = 24;
+
+    private:
+    std::shared_ptr<BfsResult> result = {};
+    NodeId source;
+    Method method;
+    uint32_t threadsCount;
+};
+} // namespace Graphs::Algorithm
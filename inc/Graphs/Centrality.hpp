@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Centralities indexed by node id, ids not present in the graph have 0.
+        betweenness - sum over ordered pairs (s, t) of the fraction of
+                      shortest s-t paths passing through the node, so on
+                      symmetric graphs every unordered pair counts twice
+        closeness   - harmonic closeness, sum of 1 / d(s, node) over all
+                      other nodes s divided by nodes - 1, which stays
+                      defined on disconnected graphs
+        Sampled results hold for all nodes at once within the error bounds
+        with probability of at least 1 - delta, exact results have bounds 0.
+*/
+struct CentralityResult
+{
+    std::vector<double> betweenness;
+    std::vector<double> closeness;
+    uint32_t sourcesAmount = 0;
+    double betweennessError = 0;
+    double closenessError = 0;
+};
+
+/*
+        Uniformly sampled sources, their amount follows from the Hoeffding
+        bound with a union bound over all nodes: ln(2n / delta) / (2 eps^2).
+        epsilon is relative to the largest possible value, (n - 2) * n for
+        betweenness and n / (n - 1) for closeness.
+*/
+struct CentralitySampling
+{
+    double epsilon;
+    double delta = 0.1;
+    uint64_t seed = 0;
+};
+
+/*
+        Brandes' algorithm: one shortest-path traversal per source (BFS, or
+        Dijkstra on weighted graphs) followed by the accumulation of
+        dependencies in reverse order of distance. Sources are split between
+        threads, every thread owns its traversal buffers and partial sums,
+        which are reduced at the end. Closeness comes from the same traversals.
+        Weights have to be positive.
+*/
+class Centrality : public AlgorithmFunctor
+{
+    public:
+    Centrality(std::shared_ptr<CentralityResult> resultContainer,
+               uint32_t threadsCount = 0,
+               std::optional<CentralitySampling> sampling = std::nullopt)
+        : result(std::move(resultContainer)), threadsCount(threadsCount), sampling(sampling) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Centrality result cannot be null"};
+        }
+        if (sampling.has_value() and (sampling->epsilon <= 0 or sampling->delta <= 0 or sampling->delta >= 1))
+        {
+            throw std::invalid_argument{"Sampling requires epsilon > 0 and 0 < delta < 1"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    static uint32_t samplesAmount(uint32_t nodesCount, const CentralitySampling&);
+
+    private:
+    std::shared_ptr<CentralityResult> result = {};
+    uint32_t threadsCount;
+    std::optional<CentralitySampling> sampling;
+};
+} // namespace Graphs::Algorithm
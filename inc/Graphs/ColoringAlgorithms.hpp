@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <Graphs/Algorithm.hpp>
 #include <iosfwd>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <random>
 #include <vector>
 
 namespace Graphs::Algorithm
@@ -12,6 +17,12 @@ using ColorId = uint32_t;
 using ColoringInfo = std::pair<NodeId, ColorId>;
 using ColoringResult = std::vector<ColoringInfo>;
 
+/* Node ids ordered by non-increasing degree (ties by id), built with a counting sort over degrees */
+Permutation largestFirstOrder(const Graphs::Graph&);
+
+/* Node ids in reversed core decomposition removal order, greedy coloring in it uses at most degeneracy + 1 colors */
+Permutation smallestLastOrder(const Graphs::Graph&);
+
 template <bool isVerbose>
 class GreedyColoring : public AlgorithmFunctor
 {
@@ -35,8 +46,13 @@ class GreedyColoring : public AlgorithmFunctor
         }
     }
 
+    /* Runs the static path for the backends that have one, the graph interface otherwise */
     void operator()(const Graphs::Graph&) override;
 
+    /* Chosen by overload resolution whenever the backend type is known at compile time */
+    template <StaticGraph GraphType>
+    void operator()(const GraphType&);
+
     private:
     template <class... Args, class T = void, Verbose<isVerbose, T> = nullptr>
     void log(std::string, Args...) const;
@@ -44,4 +60,57 @@ class GreedyColoring : public AlgorithmFunctor
     std::shared_ptr<ColoringResult> result = {};
     std::ostream& outStream;
 };
+
+/*
+        Same coloring as through the graph interface, but colors are kept in
+        a table indexed by the dense node ids instead of a map of positions
+        and the rows are read in place. Verbose runs stay on the interface,
+        which already knows how to log every step.
+*/
+template <bool isVerbose>
+template <StaticGraph GraphType>
+void GreedyColoring<isVerbose>::operator()(const GraphType& graph) {
+    if constexpr (isVerbose)
+    {
+        (*this)(static_cast<const Graphs::Graph&>(graph));
+    }
+    else
+    {
+        constexpr auto uncolored = std::numeric_limits<ColorId>::max();
+        const auto nodesCount = graph.nodesAmount();
+
+        Permutation nodes(nodesCount);
+        std::iota(nodes.begin(), nodes.end(), 0);
+        std::shuffle(nodes.begin(), nodes.end(), std::random_device{});
+
+        std::pmr::vector<ColorId> colors(nodesCount, uncolored);
+        std::pmr::vector<std::size_t> usedColorMarks;
+        result->resize(nodesCount);
+
+        for (std::size_t i = 0; i < nodesCount; i++)
+        {
+            const auto mark = i + 1;
+            graph.forEachNeighbor(nodes[i], [&colors, &usedColorMarks, mark](NodeId neighbor) {
+                auto neighborColor = colors[neighbor];
+                if (neighborColor == uncolored)
+                {
+                    return;
+                }
+                if (neighborColor >= usedColorMarks.size())
+                {
+                    usedColorMarks.resize(neighborColor + 1, 0);
+                }
+                usedColorMarks[neighborColor] = mark;
+            });
+
+            ColorId color = 0;
+            while (color < usedColorMarks.size() and usedColorMarks[color] == mark)
+            {
+                color++;
+            }
+            colors[nodes[i]] = color;
+            (*result)[i] = {nodes[i], color};
+        }
+    }
+}
 } // namespace Graphs::Algorithm
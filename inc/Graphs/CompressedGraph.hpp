@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Graph.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        StreamVByte codec: values are stored in groups of four, one control
+        byte per group holds the byte lengths (1 to 4) of its values as 2-bit
+        fields, and all control bytes of a list precede its data bytes. The
+        data of a group starts at a position known from its control byte
+        alone, so decoding needs no branch per byte.
+*/
+namespace StreamVByte
+{
+/* Decoding reads whole 32-bit words, so encoded buffers are padded with this many bytes */
+constexpr std::size_t padding = 3;
+
+constexpr std::array<uint8_t, 256> groupLengths = [] {
+    std::array<uint8_t, 256> lengths = {};
+    for (uint32_t control = 0; control < 256; control++)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            lengths[control] += static_cast<uint8_t>(((control >> (2 * i)) & 3) + 1);
+        }
+    }
+    return lengths;
+}();
+
+constexpr std::size_t controlBytes(uint32_t count) {
+    return (static_cast<std::size_t>(count) + 3) / 4;
+}
+
+void encode(std::span<const uint32_t>, std::vector<uint8_t>&);
+
+/* Skips the data of count values starting at the control bytes, returns the end of their data */
+inline const uint8_t* skip(const uint8_t* controls, uint32_t count) {
+    const auto* data = controls + controlBytes(count);
+    for (uint32_t group = 0; group < count / 4; group++)
+    {
+        data += groupLengths[controls[group]];
+    }
+    for (uint32_t i = 0; i < count % 4; i++)
+    {
+        data += ((controls[count / 4] >> (2 * i)) & 3) + 1;
+    }
+    return data;
+}
+
+/* Calls visitor(value) for count values starting at the control bytes, returns the end of their data */
+template <class Visitor>
+const uint8_t* decode(const uint8_t* controls, uint32_t count, Visitor visitor) {
+    constexpr uint32_t masks[] = {0xFF, 0xFFFF, 0xFFFFFF, 0xFFFFFFFF};
+    const auto* data = controls + controlBytes(count);
+    auto decodeValue = [&data, &visitor, &masks](uint32_t length) {
+        uint32_t word;
+        std::memcpy(&word, data, sizeof(word));
+        visitor(word & masks[length]);
+        data += length + 1;
+    };
+
+    // whole groups with a fixed trip count, which compilers unroll
+    for (uint32_t group = 0; group < count / 4; group++)
+    {
+        const uint32_t control = controls[group];
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            decodeValue((control >> (2 * i)) & 3);
+        }
+    }
+    for (uint32_t i = 0; i < count % 4; i++)
+    {
+        decodeValue((controls[count / 4] >> (2 * i)) & 3);
+    }
+    return data;
+}
+} // namespace StreamVByte
+
+/*
+        Read-only graph with StreamVByte compressed neighbor lists. Each row
+        starts with the varint degree, followed by the neighbor list (the
+        first neighbor as a zigzag difference to the node, then gaps between
+        sorted neighbors) and, for weighted graphs, the weights. Rows are
+        decoded on the fly. Only every block of 8 nodes has a 64-bit offset,
+        a row inside the block is found by skipping the rows before it, whose
+        degrees and control bytes give their lengths. A per-node offset would
+        cost as much as the whole row of a sparse graph.
+        Node ids are dense like in the CsrGraph it is built from, with the
+        same originalId() mapping and metadata.
+*/
+class CompressedGraph final : public Graph
+{
+    public:
+    CompressedGraph(const Graph&);
+
+    CompressedGraph(CompressedGraph&) = delete;
+    CompressedGraph(CompressedGraph&&) = default;
+
+    uint32_t nodesAmount() const override;
+    uint32_t nodeDegree(NodeId) const override;
+    EdgeInfo findEdge(const EdgeInfo&) const override;
+
+    void setEdge(const EdgeInfo&) override;
+    void addNodes(uint32_t) override;
+    void removeNode(NodeId) override;
+    void removeEdge(const EdgeInfo&) override;
+
+    std::vector<NodeId> getNodeIds() const override;
+    std::vector<NodeId> getNeighborsOf(NodeId) const override;
+
+    /* Calls visitor(neighbor) for the sorted neighbors of a node, decoding them on the fly */
+    template <class Visitor>
+    void forEachNeighbor(NodeId node, Visitor visitor) const {
+        const auto* row = rowStart(node);
+        const auto degree = readDegree(row);
+        decodeRow(node, row, degree, visitor);
+    }
+
+    std::span<const NodeId> decodeNeighbors(NodeId, std::vector<NodeId>&) const;
+    std::span<const uint32_t> decodeWeights(NodeId, std::vector<uint32_t>&) const;
+
+    bool isWeighted() const;
+    uint64_t edgesAmount() const;
+    std::size_t memoryUsage() const;
+    CsrGraph toCsr() const;
+
+    NodeId originalId(NodeId) const;
+    const Metadata& metadata() const;
+
+    virtual ~CompressedGraph() = default;
+
+    private:
+    std::string show() const override;
+
+    static constexpr uint32_t blockShift = 3;
+
+    /* Walks from the start of the block over the rows before the node, each one skipped through its control bytes */
+    const uint8_t* rowStart(NodeId node) const {
+        const auto* row = bytes.data() + blockOffsets[node >> blockShift];
+        for (auto skipped = node & ((1u << blockShift) - 1); skipped > 0; skipped--)
+        {
+            const auto degree = readDegree(row);
+            row = StreamVByte::skip(row, degree);
+            if (weighted)
+            {
+                row = StreamVByte::skip(row, degree);
+            }
+        }
+        return row;
+    }
+
+    /* Decodes the neighbors of a row positioned after its degree, returns the end of their data */
+    template <class Visitor>
+    static const uint8_t* decodeRow(NodeId node, const uint8_t* row, uint32_t degree, Visitor visitor) {
+        auto neighbor = node;
+        bool first = true;
+        return StreamVByte::decode(row, degree, [&](uint32_t value) {
+            neighbor += first ? unzigzag(value) : value;
+            first = false;
+            visitor(neighbor);
+        });
+    }
+
+    static uint32_t readDegree(const uint8_t*& row) {
+        uint32_t degree = 0;
+        for (uint32_t shift = 0;; shift += 7)
+        {
+            auto byte = *row++;
+            degree |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return degree;
+            }
+        }
+    }
+
+    static uint32_t unzigzag(uint32_t value) {
+        return (value >> 1) ^ (0u - (value & 1));
+    }
+
+    std::vector<uint64_t> blockOffsets;
+    std::vector<uint8_t> bytes;
+    uint32_t nodesCount = 0;
+    std::vector<NodeId> originalIds;
+    uint64_t arcs = 0;
+    bool weighted = false;
+    Metadata meta;
+};
+} // namespace Graphs
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <Graphs/GridGraph.hpp>
+#include <Graphs/Pixel_map.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Component labels indexed by node id (or by row-major pixel index for
+        pixel maps). Ids not present in the graph and walls are labeled with
+        noComponent. Labels are dense, in order of the first node of each
+        component, and sizes are indexed by label.
+*/
+struct ComponentLabels
+{
+    static constexpr uint32_t noComponent = std::numeric_limits<uint32_t>::max();
+
+    std::vector<uint32_t> labels;
+    std::vector<uint32_t> sizes;
+
+    uint32_t componentsAmount() const {
+        return static_cast<uint32_t>(sizes.size());
+    }
+
+    uint32_t componentOf(NodeId node) const {
+        return node < labels.size() ? labels[node] : noComponent;
+    }
+
+    bool connected(NodeId lhs, NodeId rhs) const {
+        auto label = componentOf(lhs);
+        return label != noComponent and label == componentOf(rhs);
+    }
+};
+
+/*
+        Weakly connected components. Method::unionFind runs a sequential
+        union-find over all edges. Method::parallel hooks roots lock-free from
+        all threads (always linking the larger root under the smaller one, as
+        in Shiloach-Vishkin) and finishes with parallel pointer jumping.
+        Pixel maps are labeled with two passes over runs of open pixels.
+*/
+class ConnectedComponents : public AlgorithmFunctor
+{
+    public:
+    enum class Method
+    {
+        unionFind = 0,
+        parallel
+    };
+
+    ConnectedComponents(std::shared_ptr<ComponentLabels> resultContainer,
+                        Method method = Method::unionFind,
+                        uint32_t threadsCount = 0)
+        : result(std::move(resultContainer)), method(method), threadsCount(threadsCount) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Component labels cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+    void operator()(const Data::Pixel_map&, GridGraph::Connectivity = GridGraph::Connectivity::four);
+
+    private:
+    std::shared_ptr<ComponentLabels> result = {};
+    Method method;
+    uint32_t threadsCount;
+};
+} // namespace Graphs::Algorithm
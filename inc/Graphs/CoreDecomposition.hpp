@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Core numbers of the undirected simple form of a graph indexed by node
+        id, ids not present in the graph have 0. removalOrder lists node ids
+        in the order they were peeled off, always a node of minimum remaining
+        degree, so every node has at most degeneracy neighbors later in it.
+        Reversed it is the smallest-last ordering for greedy coloring.
+*/
+struct CoreResult
+{
+    std::vector<uint32_t> coreNumbers;
+    Permutation removalOrder;
+    uint32_t degeneracy = 0;
+};
+
+/* Bucket-based peeling of Batagelj and Zaversnik, O(n + m) */
+class CoreDecomposition : public AlgorithmFunctor
+{
+    public:
+    CoreDecomposition(std::shared_ptr<CoreResult> resultContainer) : result(std::move(resultContainer)) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Core result cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    private:
+    std::shared_ptr<CoreResult> result = {};
+};
+} // namespace Graphs::Algorithm
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Graph.hpp>
+#include <map>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Graphs
+{
+using Metadata = std::map<std::string, std::string>;
+
+/* Metadata entry set to "true" by producers that always store both directions of every edge */
+constexpr auto symmetricKey = "symmetric";
+
+/*
+        Read-only graph stored in the compressed sparse row form. Node ids are
+        dense indices in range [0, nodesAmount()), neighbor lists are sorted.
+        Supported file formats are the text ".lst" adjacency list (ids in the
+        file are 1-based) and the binary ".csr" format.
+        The arrays come from the memory resource given on load, which lets
+        large graphs be placed on huge pages or across memory nodes with a
+        Memory::PlacementResource that outlives the graph.
+*/
+class CsrGraph final : public Graph
+{
+    public:
+    using Offset = uint64_t;
+
+    CsrGraph(std::string, std::pmr::memory_resource* = std::pmr::get_default_resource());
+    CsrGraph(const Graph&);
+    CsrGraph(uint32_t, std::span<const EdgeInfo>, std::pmr::memory_resource* = std::pmr::get_default_resource());
+    CsrGraph(std::pmr::vector<Offset>, std::pmr::vector<NodeId>, std::pmr::vector<uint32_t> = {}, std::pmr::vector<NodeId> = {});
+
+    CsrGraph(CsrGraph&) = delete;
+    CsrGraph(CsrGraph&&) = default;
+
+    uint32_t nodesAmount() const override;
+    uint32_t nodeDegree(NodeId) const override;
+    EdgeInfo findEdge(const EdgeInfo&) const override;
+
+    void setEdge(const EdgeInfo&) override;
+    void addNodes(uint32_t) override;
+    void removeNode(NodeId) override;
+    void removeEdge(const EdgeInfo&) override;
+
+    std::vector<NodeId> getNodeIds() const override;
+    std::vector<NodeId> getNeighborsOf(NodeId) const override;
+
+    std::span<const NodeId> neighbors(NodeId) const;
+
+    /* Same visitor interface as CompressedGraph::forEachNeighbor, for code templated over both */
+    template <class Visitor>
+    void forEachNeighbor(NodeId node, Visitor visitor) const {
+        for (auto neighbor : neighbors(node))
+        {
+            visitor(neighbor);
+        }
+    }
+
+    std::span<const uint32_t> weights(NodeId) const;
+    bool isWeighted() const;
+    uint64_t edgesAmount() const;
+    std::size_t memoryUsage() const;
+
+    NodeId originalId(NodeId) const;
+
+    const Metadata& metadata() const;
+    Metadata& metadata();
+
+    void save(const std::string&) const;
+
+    /* Returns the graph itself if it already is a CsrGraph, or its conversion stored in the holder */
+    static const CsrGraph& from(const Graph&, std::optional<CsrGraph>&);
+
+    virtual ~CsrGraph() = default;
+
+    private:
+    std::string show() const override;
+
+    void buildFromEdges(uint32_t, std::span<const EdgeInfo>);
+    void buildFromLstFile(const std::string&);
+    void buildFromCsrFile(const std::string&);
+    void saveLstFile(const std::string&) const;
+    void saveCsrFile(const std::string&) const;
+
+    std::pmr::vector<Offset> offsets = {0};
+    std::pmr::vector<NodeId> adjacency;
+    std::pmr::vector<uint32_t> adjacencyWeights;
+    std::pmr::vector<NodeId> originalIds;
+    Metadata meta;
+};
+} // namespace Graphs
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Min-heap of elements [0, size) with keys, where every element knows
+        its position, so keys can be decreased in place. A wider arity makes
+        the tree shallower, trading cheaper decreases for more comparisons
+        per pop, which suits algorithms with many more decreases than pops.
+*/
+template <class Key, uint32_t arity = 4>
+class DaryHeap
+{
+    public:
+    DaryHeap(uint32_t size) : keys(size), positions(size, absent) {}
+
+    bool empty() const {
+        return elements.empty();
+    }
+
+    bool contains(uint32_t element) const {
+        return positions[element] != absent;
+    }
+
+    const Key& key(uint32_t element) const {
+        return keys[element];
+    }
+
+    /* Inserts the element, or lowers its key when the new one is smaller */
+    void push(uint32_t element, const Key& key) {
+        if (not contains(element))
+        {
+            keys[element] = key;
+            positions[element] = static_cast<uint32_t>(elements.size());
+            elements.push_back(element);
+            siftUp(positions[element]);
+        }
+        else if (key < keys[element])
+        {
+            keys[element] = key;
+            siftUp(positions[element]);
+        }
+    }
+
+    uint32_t pop() {
+        auto top = elements.front();
+        positions[top] = absent;
+        auto last = elements.back();
+        elements.pop_back();
+        if (not elements.empty())
+        {
+            elements.front() = last;
+            positions[last] = 0;
+            siftDown(0);
+        }
+        return top;
+    }
+
+    private:
+    static constexpr uint32_t absent = std::numeric_limits<uint32_t>::max();
+
+    void place(uint32_t position, uint32_t element) {
+        elements[position] = element;
+        positions[element] = position;
+    }
+
+    void siftUp(uint32_t position) {
+        auto element = elements[position];
+        while (position > 0)
+        {
+            auto parent = (position - 1) / arity;
+            if (not(keys[element] < keys[elements[parent]]))
+            {
+                break;
+            }
+            place(position, elements[parent]);
+            position = parent;
+        }
+        place(position, element);
+    }
+
+    void siftDown(uint32_t position) {
+        auto element = elements[position];
+        const auto size = static_cast<uint32_t>(elements.size());
+        while (true)
+        {
+            auto first = position * arity + 1;
+            if (first >= size)
+            {
+                break;
+            }
+            auto smallest = first;
+            for (auto child = first + 1; child < std::min(first + arity, size); child++)
+            {
+                smallest = keys[elements[child]] < keys[elements[smallest]] ? child : smallest;
+            }
+            if (not(keys[elements[smallest]] < keys[element]))
+            {
+                break;
+            }
+            place(position, elements[smallest]);
+            position = smallest;
+        }
+        place(position, element);
+    }
+
+    std::vector<Key> keys;
+    std::vector<uint32_t> positions;
+    std::vector<uint32_t> elements;
+};
+} // namespace Graphs
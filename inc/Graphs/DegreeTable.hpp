@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Graph.hpp>
+#include <span>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Degrees indexed by node id, kept next to the adjacency of a mutable
+        backend and updated on every mutation. A histogram of degrees keeps
+        the maximum degree available without rescanning all nodes.
+*/
+class DegreeTable
+{
+    public:
+    void resize(std::size_t);
+
+    void increment(NodeId);
+    void decrement(NodeId);
+    void set(NodeId, uint32_t);
+
+    uint32_t degree(NodeId node) const {
+        return node < values.size() ? values[node] : 0;
+    }
+
+    uint32_t maxDegree() const {
+        return maximum;
+    }
+
+    std::span<const uint32_t> all() const {
+        return values;
+    }
+
+    private:
+    void move(uint32_t, uint32_t);
+
+    std::vector<uint32_t> values;
+    std::vector<uint32_t> histogram = {0};
+    uint32_t maximum = 0;
+};
+} // namespace Graphs
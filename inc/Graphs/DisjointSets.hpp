@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Union-find over elements [0, size) with union by size and path
+        halving, giving near constant amortized find and unite.
+*/
+class DisjointSets
+{
+    public:
+    DisjointSets(uint32_t);
+
+    uint32_t find(uint32_t);
+    bool unite(uint32_t, uint32_t);
+    uint32_t setSize(uint32_t);
+    uint32_t setsAmount() const;
+    uint32_t size() const;
+
+    void reset(uint32_t);
+
+    private:
+    std::vector<uint32_t> parents;
+    std::vector<uint32_t> sizes;
+    uint32_t sets;
+};
+} // namespace Graphs
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Graph.hpp>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Open-addressing set of neighbors with their arc weights. Linear
+        probing over a power of two table that is kept at most 3/4 full,
+        counting erased slots, so lookups stay O(1) expected under churn.
+*/
+class AdjacencySet
+{
+    public:
+    struct Slot
+    {
+        NodeId neighbor;
+        uint32_t weight;
+    };
+
+    // lets pmr containers of sets hand their resource down to the tables
+    using allocator_type = std::pmr::polymorphic_allocator<Slot>;
+
+    AdjacencySet() = default;
+    AdjacencySet(const allocator_type& allocator) : slots(allocator) {}
+    AdjacencySet(const AdjacencySet& other, const allocator_type& allocator)
+        : slots(other.slots, allocator), count(other.count), occupied(other.occupied) {}
+    AdjacencySet(AdjacencySet&& other, const allocator_type& allocator)
+        : slots(std::move(other.slots), allocator), count(other.count), occupied(other.occupied) {}
+    AdjacencySet(const AdjacencySet&) = default;
+    AdjacencySet(AdjacencySet&&) = default;
+
+    uint32_t size() const {
+        return count;
+    }
+
+    std::optional<uint32_t> find(NodeId) const;
+
+    /* Returns the previous weight when the neighbor was already present */
+    std::optional<uint32_t> insert(NodeId, uint32_t);
+
+    /* Returns the weight of the erased neighbor */
+    std::optional<uint32_t> erase(NodeId);
+
+    void clear();
+
+    template <class Visitor>
+    void forEach(Visitor visitor) const {
+        for (const auto& slot : slots)
+        {
+            if (slot.neighbor < erased)
+            {
+                visitor(slot.neighbor, slot.weight);
+            }
+        }
+    }
+
+    std::size_t memoryUsage() const {
+        return slots.capacity() * sizeof(Slot);
+    }
+
+    private:
+    static constexpr NodeId empty = std::numeric_limits<NodeId>::max();
+    static constexpr NodeId erased = empty - 1;
+
+    std::size_t home(NodeId) const;
+    std::size_t locate(NodeId) const;
+    void rehash(std::size_t);
+
+    std::pmr::vector<Slot> slots;
+    uint32_t count = 0;
+    uint32_t occupied = 0;
+};
+
+/*
+        Mutable backend for graphs under constant updates. Every node keeps
+        hash sets of its outgoing and incoming arcs, so setEdge, removeEdge
+        and findEdge are O(1) expected and removeNode costs O(deg).
+        Node ids are stable, removed ids are never reused, and toCsr() exports
+        a snapshot with dense ids mapped back through originalId().
+        The hash tables are allocated from the given resource, a pool suits
+        their power of two sizes.
+*/
+class DynamicGraph : public Graph
+{
+    public:
+    DynamicGraph(uint32_t = 0, std::pmr::memory_resource* = std::pmr::get_default_resource());
+    DynamicGraph(const Graph&, std::pmr::memory_resource* = std::pmr::get_default_resource());
+
+    DynamicGraph(DynamicGraph&) = delete;
+    DynamicGraph(DynamicGraph&&) = default;
+
+    uint32_t nodesAmount() const override;
+    uint32_t nodeDegree(NodeId) const override;
+    EdgeInfo findEdge(const EdgeInfo&) const override;
+
+    void setEdge(const EdgeInfo&) override;
+    void addNodes(uint32_t) override;
+    void removeNode(NodeId) override;
+    void removeEdge(const EdgeInfo&) override;
+
+    std::vector<NodeId> getNodeIds() const override;
+    std::vector<NodeId> getNeighborsOf(NodeId) const override;
+
+    uint64_t edgesAmount() const;
+    CsrGraph toCsr() const;
+    std::size_t memoryUsage() const;
+
+    virtual ~DynamicGraph() = default;
+
+    private:
+    std::string show() const override;
+
+    bool isAlive(NodeId) const;
+
+    std::pmr::vector<AdjacencySet> outArcs;
+    std::pmr::vector<AdjacencySet> inArcs;
+    std::vector<bool> alive;
+    uint32_t liveNodes = 0;
+    uint64_t arcs = 0;
+    uint64_t nonUnitWeights = 0;
+};
+} // namespace Graphs
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/LineGraph.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Edge colors indexed by the edge ids of EdgeIndex built from the
+        colored graph. workingMemory holds the bytes of auxiliary structures
+        (edge index, line graph, scratch tables) the last run needed.
+*/
+struct EdgeColoringResult
+{
+    static constexpr ColorId noColor = std::numeric_limits<ColorId>::max();
+
+    std::vector<ColorId> colors;
+    std::size_t workingMemory = 0;
+
+    ColorId colorsAmount() const {
+        ColorId amount = 0;
+        for (auto color : colors)
+        {
+            amount = std::max(amount, color + 1);
+        }
+        return amount;
+    }
+};
+
+/*
+        Proper edge coloring of the undirected simple form of a graph.
+        Method::lineGraph builds the line graph and colors its nodes with
+        GreedyColoring, which uses at most 2*maxDegree-1 colors.
+        Method::misraGries recolors fans and alternating paths directly on the
+        edge index and always fits in maxDegree+1 colors.
+*/
+class EdgeColoring : public AlgorithmFunctor
+{
+    public:
+    enum class Method
+    {
+        misraGries = 0,
+        lineGraph
+    };
+
+    EdgeColoring(std::shared_ptr<EdgeColoringResult> resultContainer, Method method = Method::misraGries)
+        : result(std::move(resultContainer)), method(method) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Edge coloring result cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+    void operator()(const EdgeIndex&);
+
+    private:
+    void colorLineGraph(const EdgeIndex&);
+    void colorMisraGries(const EdgeIndex&);
+
+    std::shared_ptr<EdgeColoringResult> result = {};
+    Method method;
+};
+} // namespace Graphs::Algorithm
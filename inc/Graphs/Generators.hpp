@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/CsrGraph.hpp>
+#include <optional>
+#include <vector>
+
+namespace Graphs::Generators
+{
+/*
+        Parameters of a graph with a planted k-coloring. Nodes are split into
+        chromaticNumber hidden parts, every pair of nodes from different parts
+        is connected with interPartProbability and one node of each part
+        belongs to an embedded clique, so the chromatic number is exactly k.
+*/
+struct PlantedColoringParameters
+{
+    uint32_t nodesCount;
+    uint32_t chromaticNumber;
+    double interPartProbability;
+    uint64_t seed = 0;
+};
+
+struct PlantedColoring
+{
+    CsrGraph graph;
+    std::vector<uint32_t> partition;
+};
+
+constexpr auto chromaticNumberKey = "chromatic_number";
+
+/*
+        Parameters of a recursive matrix (R-MAT) graph with 2^scale nodes and
+        about edgeFactor * 2^scale undirected edges, the Graph500 generator.
+        Each edge descends into one quadrant of the adjacency matrix with
+        probabilities a, b, c and 1 - a - b - c, which yields a skewed,
+        small-world degree distribution.
+*/
+struct RmatParameters
+{
+    uint32_t scale;
+    uint32_t edgeFactor = 16;
+    double a = 0.57;
+    double b = 0.19;
+    double c = 0.19;
+    uint64_t seed = 0;
+};
+
+PlantedColoring plantedColoring(const PlantedColoringParameters&);
+
+/* Symmetric graph without self-loops and duplicate edges, node ids are scrambled */
+CsrGraph rmat(const RmatParameters&);
+
+std::optional<uint32_t> knownChromaticNumber(const CsrGraph&);
+} // namespace Graphs::Generators
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace Graphs
@@ -32,12 +33,40 @@ class Graph
     virtual void addNodes(uint32_t) = 0;
     virtual void removeNode(NodeId) = 0;
     virtual void removeEdge(const EdgeInfo&) = 0;
+
+    /* Batch mutations, backends may override them to sort and merge every touched node only once */
+    virtual void setEdges(std::span<const EdgeInfo> edges) {
+        for (const auto& edge : edges)
+        {
+            setEdge(edge);
+        }
+    }
+
+    virtual void removeEdges(std::span<const EdgeInfo> edges) {
+        for (const auto& edge : edges)
+        {
+            removeEdge(edge);
+        }
+    }
+
     virtual std::vector<NodeId> getNodeIds() const = 0;
     virtual std::vector<NodeId> getNeighborsOf(NodeId) const = 0;
 
+    /* Grows with every mutation, so results derived from the graph can be cached per revision */
+    uint64_t revision() const {
+        return revisionCounter;
+    }
+
     virtual ~Graph() = default;
 
     protected:
     virtual std::string show() const = 0;
+
+    void markModified() {
+        revisionCounter++;
+    }
+
+    private:
+    uint64_t revisionCounter = 0;
 };
 } // namespace Graphs
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Graph.hpp>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Graphs::Metrics
+{
+/*
+        Degree-based topological indices of the undirected simple form of a
+        graph, each a sum over its edges uv with degrees du and dv:
+        estrada              - sqrt((du + dv - 2) / du^2) + sqrt((du + dv - 2) / dv^2),
+                               the index of the legacy AdjMatrix::estrada_index
+        randic               - 1 / sqrt(du * dv)
+        firstZagreb          - du + dv (equal to the sum of squared degrees)
+        secondZagreb         - du * dv
+        atomBondConnectivity - sqrt((du + dv - 2) / (du * dv))
+*/
+struct DegreeIndices
+{
+    double estrada = 0;
+    double randic = 0;
+    uint64_t firstZagreb = 0;
+    uint64_t secondZagreb = 0;
+    double atomBondConnectivity = 0;
+};
+
+DegreeIndices& operator+=(DegreeIndices&, const DegreeIndices&);
+
+/*
+        Computes the degree sequence once and evaluates all indices in a
+        single pass over the edge list, split between threads for large
+        graphs. Results stay cached until the revision of the graph changes,
+        so the graph has to outlive the metrics object.
+*/
+class DegreeMetrics
+{
+    public:
+    DegreeMetrics(const Graph&, uint32_t threadsCount = 0);
+
+    DegreeMetrics(DegreeMetrics&) = delete;
+    DegreeMetrics(DegreeMetrics&&) = default;
+
+    const DegreeIndices& indices();
+
+    /* Degrees indexed by node id, ids not present in the graph have degree 0 */
+    std::span<const uint32_t> degrees();
+
+    private:
+    void refresh();
+
+    const Graph& graph;
+    uint32_t threadsCount;
+    std::optional<uint64_t> computedRevision;
+    std::vector<uint32_t> degreeSequence;
+    DegreeIndices cached;
+};
+} // namespace Graphs::Metrics
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <Graphs/Graph.hpp>
+#include <Graphs/Pixel_map.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Read-only graph view over a pixel map. Every open (zero) pixel is a
+        node, neighbors are generated on the fly from the adjacent pixels, so
+        no adjacency is stored. Node ids are either the row-major pixel
+        index (Indexing::pixel), or dense ranks of open pixels resolved with
+        a rank/select index (Indexing::compact). With Connectivity::eight
+        diagonal moves are allowed unless they would cut a wall corner.
+        The map has to outlive the view.
+*/
+class GridGraph : public Graph
+{
+    public:
+    enum class Connectivity
+    {
+        four = 0,
+        eight
+    };
+
+    enum class Indexing
+    {
+        pixel = 0,
+        compact
+    };
+
+    GridGraph(const Data::Pixel_map&, Connectivity = Connectivity::four, Indexing = Indexing::pixel);
+
+    GridGraph(GridGraph&) = delete;
+    GridGraph(GridGraph&&) = delete;
+
+    uint32_t nodesAmount() const override;
+    uint32_t nodeDegree(NodeId) const override;
+    EdgeInfo findEdge(const EdgeInfo&) const override;
+
+    void setEdge(const EdgeInfo&) override;
+    void addNodes(uint32_t) override;
+    void removeNode(NodeId) override;
+    void removeEdge(const EdgeInfo&) override;
+
+    std::vector<NodeId> getNodeIds() const override;
+    std::vector<NodeId> getNeighborsOf(NodeId) const override;
+
+    bool isOpen(uint32_t row, uint32_t column) const;
+    NodeId toNodeId(uint32_t row, uint32_t column) const;
+    Data::coord toCoord(NodeId) const;
+
+    const Data::Pixel_map& pixelMap() const;
+    Connectivity connectivity() const;
+
+    template <class Visitor>
+    void forEachNeighbor(NodeId node, Visitor visit) const {
+        auto [row, column] = toCoord(node);
+        forEachNeighborPixel(row, column, [this, &visit](uint32_t neighborRow, uint32_t neighborColumn) {
+            visit(toNodeId(neighborRow, neighborColumn));
+        });
+    }
+
+    template <class Visitor>
+    void forEachNeighborPixel(uint32_t row, uint32_t column, Visitor visit) const {
+        constexpr std::array<std::pair<int32_t, int32_t>, 4> straight = {
+            {{-1, 0}, {0, -1}, {0, 1}, {1, 0}}
+        };
+        constexpr std::array<std::pair<int32_t, int32_t>, 4> diagonal = {
+            {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}}
+        };
+
+        for (auto [rowStep, columnStep] : straight)
+        {
+            if (isOpenAt(static_cast<int64_t>(row) + rowStep, static_cast<int64_t>(column) + columnStep))
+            {
+                visit(row + rowStep, column + columnStep);
+            }
+        }
+
+        if (mode != Connectivity::eight)
+        {
+            return;
+        }
+
+        for (auto [rowStep, columnStep] : diagonal)
+        {
+            if (isOpenAt(static_cast<int64_t>(row) + rowStep, static_cast<int64_t>(column) + columnStep)
+                and isOpenAt(static_cast<int64_t>(row) + rowStep, column)
+                and isOpenAt(row, static_cast<int64_t>(column) + columnStep))
+            {
+                visit(row + rowStep, column + columnStep);
+            }
+        }
+    }
+
+    virtual ~GridGraph() = default;
+
+    private:
+    std::string show() const override;
+
+    bool isOpenAt(int64_t row, int64_t column) const;
+    uint64_t rank(uint64_t pixel) const;
+    uint64_t select(uint64_t rank) const;
+
+    const Data::Pixel_map& map;
+    Connectivity mode;
+    Indexing indexing;
+
+    uint32_t openPixels = 0;
+    std::vector<uint64_t> openBits;
+    std::vector<uint32_t> blockRanks;
+};
+} // namespace Graphs
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/GridGraph.hpp>
+#include <Graphs/Pixel_map.hpp>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Result of a single grid query. The path lists every pixel from the
+        start to the goal, the length counts straight steps as 1 and
+        diagonal steps as sqrt(2).
+*/
+struct GridPath
+{
+    bool found = false;
+    double length = 0.0;
+    uint64_t expandedNodes = 0;
+    std::vector<Data::coord> pixels;
+};
+
+/*
+        Shortest path queries between pixels of a single map. All the search
+        state (costs, parents, open list, frontiers) is allocated once, in the
+        constructor, and invalidated between queries by bumping a generation
+        counter instead of clearing, so a query costs only the nodes it
+        touches. Passing the same GridPath to consecutive queries also reuses
+        its pixel buffer. The pathfinder keeps about 12 bytes per pixel and is
+        not thread-safe; use one instance per thread.
+*/
+class GridPathfinder
+{
+    public:
+    enum class Heuristic
+    {
+        manhattan = 0,
+        octile
+    };
+
+    GridPathfinder(const Data::Pixel_map&, GridGraph::Connectivity = GridGraph::Connectivity::four);
+
+    GridPathfinder(GridPathfinder&) = delete;
+    GridPathfinder(GridPathfinder&&) = delete;
+
+    bool breadthFirst(Data::coord, Data::coord, GridPath&);
+    bool aStar(Data::coord, Data::coord, GridPath&);
+    bool aStar(Data::coord, Data::coord, Heuristic, GridPath&);
+    bool jumpPoint(Data::coord, Data::coord, GridPath&);
+
+    private:
+    struct OpenEntry
+    {
+        uint32_t estimate;
+        uint32_t cost;
+        uint32_t pixel;
+    };
+
+    uint32_t beginQuery(Data::coord, Data::coord, GridPath&);
+    uint32_t heuristic(uint32_t, uint32_t, Heuristic) const;
+    bool isOpen(int64_t, int64_t) const;
+    uint32_t toPixel(uint32_t, uint32_t) const;
+    void pushOpen(uint32_t, uint32_t, uint32_t);
+    void reconstructPath(uint32_t, uint32_t, GridPath&);
+    void appendSegment(uint32_t, uint32_t, GridPath&) const;
+    int64_t jump(int64_t, int64_t, int32_t, int32_t, uint32_t) const;
+    int64_t jumpStraight(int64_t, int64_t, int32_t, int32_t, uint32_t) const;
+
+    GridGraph grid;
+    uint32_t rows;
+    uint32_t columns;
+
+    uint32_t generation = 0;
+    std::vector<uint32_t> marks;
+    std::vector<uint32_t> costs;
+    std::vector<uint32_t> parents;
+
+    std::vector<OpenEntry> openList;
+    std::vector<uint32_t> forwardFrontier;
+    std::vector<uint32_t> backwardFrontier;
+    std::vector<uint32_t> nextFrontier;
+    std::vector<uint32_t> waypoints;
+};
+} // namespace Graphs::Algorithm
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/CsrGraph.hpp>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Graphs
+{
+using EdgeId = uint32_t;
+
+/*
+        Undirected simple view of the edges of a graph. Arcs in either
+        direction between the same pair of nodes become a single edge and
+        self-loops are dropped. Edge ids are dense, ordered by (lower, higher)
+        endpoint, and every node keeps the sorted ids of its incident edges.
+        Endpoints are dense node indices of the CsrGraph form of the graph.
+*/
+class EdgeIndex
+{
+    public:
+    using Endpoints = std::pair<NodeId, NodeId>;
+
+    EdgeIndex(const Graph&);
+
+    EdgeIndex(EdgeIndex&) = delete;
+    EdgeIndex(EdgeIndex&&) = default;
+
+    uint32_t nodesAmount() const;
+    uint32_t edgesAmount() const;
+    uint32_t maxDegree() const;
+
+    Endpoints endpoints(EdgeId) const;
+    std::span<const Endpoints> allEndpoints() const;
+    std::span<const EdgeId> incidentEdges(NodeId) const;
+    NodeId originalId(NodeId) const;
+
+    std::size_t memoryUsage() const;
+
+    private:
+    std::vector<Endpoints> edgeEndpoints;
+    std::vector<uint64_t> incidenceOffsets;
+    std::vector<EdgeId> incidence;
+    std::vector<NodeId> originalIds;
+};
+
+/*
+        Line graph of the undirected simple form of a graph: node i of the
+        line graph is edge i of the edge index, and two of them are adjacent
+        when the edges share an endpoint. Built in O(sum of deg^2) time and
+        memory, by merging the incident edge lists of both endpoints.
+*/
+struct LineGraph
+{
+    EdgeIndex edges;
+    CsrGraph graph;
+};
+
+LineGraph makeLineGraph(const Graph&);
+CsrGraph makeLineGraph(const EdgeIndex&);
+} // namespace Graphs
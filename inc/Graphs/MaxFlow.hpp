@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+struct EdgeFlow
+{
+    NodeId source;
+    NodeId destination;
+    uint32_t capacity;
+    uint32_t flow;
+};
+
+/*
+        Maximum flow between two nodes, with edge weights as capacities
+        (unweighted edges have capacity 1). edgeFlows lists every edge of the
+        graph, sourceSide holds the sorted ids of the nodes reachable from
+        the source in the residual graph, i.e. the source side of a minimum
+        cut, and cutEdges the edges leaving it, all saturated.
+*/
+struct FlowResult
+{
+    uint64_t value = 0;
+    std::vector<EdgeFlow> edgeFlows;
+    std::vector<NodeId> sourceSide;
+    std::vector<EdgeFlow> cutEdges;
+};
+
+/*
+        Method::pushRelabel is the FIFO push-relabel algorithm with periodic
+        global relabeling (backward BFS from the sink, then from the source
+        for nodes cut off from it) and the gap heuristic. Method::dinic
+        augments blocking flows found by an iterative DFS over the BFS
+        level graph. Both run on a residual graph in CSR form, where every
+        edge is paired with its reverse residual arc.
+*/
+class MaxFlow : public AlgorithmFunctor
+{
+    public:
+    enum class Method
+    {
+        pushRelabel = 0,
+        dinic
+    };
+
+    MaxFlow(std::shared_ptr<FlowResult> resultContainer, NodeId source, NodeId sink, Method method = Method::pushRelabel)
+        : result(std::move(resultContainer)), source(source), sink(sink), method(method) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Flow result cannot be null"};
+        }
+        if (source == sink)
+        {
+            throw std::invalid_argument{"Flow source and sink have to differ"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    private:
+    std::shared_ptr<FlowResult> result = {};
+    NodeId source;
+    NodeId sink;
+    Method method;
+};
+} // namespace Graphs::Algorithm
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <Graphs/Algorithm.hpp>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Largest clique found, as sorted node ids of the undirected simple form
+        of the graph. optimal is false when the search hit the time limit,
+        then the clique is the best one found so far.
+*/
+struct CliqueResult
+{
+    std::vector<NodeId> clique;
+    bool optimal = false;
+    uint64_t branches = 0;
+};
+
+struct CliqueProgress
+{
+    uint32_t incumbentSize;
+    uint64_t branches;
+    std::chrono::milliseconds elapsed;
+};
+
+/*
+        Branch and bound in the style of Tomita's MCS with the bitset
+        encoding of San Segundo (BBMC). Nodes are numbered in core
+        decomposition removal order, so the root branch of node i only
+        considers its neighbors numbered above i, at most degeneracy of them.
+        Nodes of core number below the size of an initial greedy clique are
+        dropped first. Each root branch relabels its candidates 0..k and
+        builds a BitMatrix over them alone, so a thread holds O(degeneracy^2)
+        bits whatever the size of the graph. Inside a branch the candidates
+        are greedily colored with bitset operations and the number of colors
+        bounds the clique size that can still be reached. Root branches are
+        shared between threads through a counter and the incumbent size is
+        shared atomically, so any thread prunes with the best clique found by
+        all of them. The progress callback is called from the improving
+        thread whenever the incumbent grows.
+*/
+class MaximumClique : public AlgorithmFunctor
+{
+    public:
+    using ProgressCallback = std::function<void(const CliqueProgress&)>;
+
+    MaximumClique(std::shared_ptr<CliqueResult> resultContainer,
+                  uint32_t threadsCount = 0,
+                  std::optional<std::chrono::milliseconds> timeLimit = std::nullopt,
+                  ProgressCallback progress = {})
+        : result(std::move(resultContainer)), threadsCount(threadsCount), timeLimit(timeLimit), progress(std::move(progress)) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Clique result cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    private:
+    std::shared_ptr<CliqueResult> result = {};
+    uint32_t threadsCount;
+    std::optional<std::chrono::milliseconds> timeLimit;
+    ProgressCallback progress;
+};
+} // namespace Graphs::Algorithm
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace Graphs::Memory
+{
+struct AllocationStats
+{
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t allocatedBytes = 0;
+    uint64_t peakBytes = 0;
+};
+
+/*
+        Memory resource forwarding to an upstream resource while counting
+        the allocations passing through it. The counters are atomic, so one
+        instance may serve several threads when its upstream can.
+*/
+class CountingResource : public std::pmr::memory_resource
+{
+    public:
+    CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) : upstream(upstream) {}
+
+    AllocationStats stats() const;
+    void reset();
+
+    private:
+    void* do_allocate(std::size_t, std::size_t) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override;
+    bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+    std::pmr::memory_resource* upstream;
+    std::atomic<uint64_t> allocations = 0;
+    std::atomic<uint64_t> deallocations = 0;
+    std::atomic<uint64_t> allocatedBytes = 0;
+    std::atomic<uint64_t> liveBytes = 0;
+    std::atomic<uint64_t> peakBytes = 0;
+};
+
+/* Makes a resource the std::pmr default one until the end of the scope */
+class ScopedDefaultResource
+{
+    public:
+    ScopedDefaultResource(std::pmr::memory_resource* resource) : previous(std::pmr::set_default_resource(resource)) {}
+
+    ScopedDefaultResource(ScopedDefaultResource&) = delete;
+    ScopedDefaultResource(ScopedDefaultResource&&) = delete;
+
+    ~ScopedDefaultResource() {
+        std::pmr::set_default_resource(previous);
+    }
+
+    private:
+    std::pmr::memory_resource* previous;
+};
+
+enum class PageSize
+{
+    standard = 0,
+    transparentHuge,
+    hugeTlb
+};
+
+enum class NumaPolicy
+{
+    none = 0,
+    interleave,
+    firstTouch
+};
+
+/*
+        Placement of large graph arrays. Interleaving spreads the pages of
+        read-shared arrays over all memory nodes, first touch faults every
+        page in from the thread that forEachChunk would give that part of
+        the buffer, so chunked parallel loops mostly read local memory.
+*/
+struct Placement
+{
+    PageSize pages = PageSize::standard;
+    NumaPolicy numa = NumaPolicy::none;
+    uint32_t threadsCount = 0;
+};
+
+std::string toString(PageSize);
+std::string toString(NumaPolicy);
+
+/* Ids of the online memory nodes, a single node 0 when the system does not report them */
+std::vector<uint32_t> onlineNumaNodes();
+
+/*
+        Maps blocks of at least hugePageSize bytes straight from the kernel
+        and applies the placement to them, smaller blocks go to the upstream
+        resource. Explicit huge pages need a reserved hugetlbfs pool, without
+        one the block falls back to transparent huge pages. Interleaving on a
+        single memory node is a no-op. effective() reports the placement that
+        was actually achieved, fallbacks included. Off Linux every block goes
+        to the upstream resource and the placement is always standard/none.
+*/
+class PlacementResource : public std::pmr::memory_resource
+{
+    public:
+    static constexpr std::size_t hugePageSize = std::size_t{2} << 20;
+
+    PlacementResource(Placement, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    Placement requested() const {
+        return placement;
+    }
+
+    Placement effective() const;
+
+    private:
+    void* do_allocate(std::size_t, std::size_t) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override;
+    bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+    bool isMapped(std::size_t bytes) const;
+    std::size_t mappedSize(std::size_t bytes) const;
+    void* mapPages(std::size_t);
+    void applyNumaPolicy(void*, std::size_t);
+
+    Placement placement;
+    std::pmr::memory_resource* upstream;
+    std::vector<uint32_t> numaNodes;
+    std::atomic<bool> hugeTlbUnavailable = false;
+    std::atomic<bool> transparentHugeUnavailable = false;
+    std::atomic<bool> numaUnavailable = false;
+};
+} // namespace Graphs::Memory
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Edges of a minimum spanning forest in original node ids, sorted by
+        (source, destination), with their weights (1 for unweighted graphs).
+        treesAmount is the number of trees, isolated nodes included.
+*/
+struct SpanningForest
+{
+    std::vector<EdgeInfo> edges;
+    uint64_t totalWeight = 0;
+    uint32_t treesAmount = 0;
+};
+
+/*
+        Minimum spanning forest of the undirected form of a graph, every arc
+        being an edge between its endpoints. Ties between equal weights are
+        broken by the position of the arc in the CSR form of the graph, so all
+        methods return the same forest.
+        Method::kruskal sorts the edges in parallel and adds them through
+        union-find, Method::prim grows every tree with a 4-ary heap, and
+        Method::boruvka lets every component pick its lightest edge in
+        parallel, roughly halving the components in every round.
+*/
+class MinimumSpanningForest : public AlgorithmFunctor
+{
+    public:
+    enum class Method
+    {
+        kruskal = 0,
+        prim,
+        boruvka
+    };
+
+    MinimumSpanningForest(std::shared_ptr<SpanningForest> resultContainer, Method method = Method::kruskal, uint32_t threadsCount = 0)
+        : result(std::move(resultContainer)), method(method), threadsCount(threadsCount) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Spanning forest cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    private:
+    std::shared_ptr<SpanningForest> result = {};
+    Method method;
+    uint32_t threadsCount;
+};
+
+/*
+        Minimum spanning forest of edges arriving one at a time, in memory
+        proportional to the nodes plus batchSize. Arrived edges are buffered
+        and every full batch, at least as large as the forest, is merged
+        with the current forest by Kruskal, keeping only the new forest.
+        Equal weights are broken by arrival.
+*/
+class StreamingSpanningForest
+{
+    public:
+    StreamingSpanningForest(uint32_t batchSize = 1 << 16);
+
+    void insert(const EdgeInfo&);
+    SpanningForest forest();
+
+    private:
+    struct Edge
+    {
+        NodeId source;
+        NodeId destination;
+        uint32_t weight;
+    };
+
+    void flush();
+
+    uint32_t batchSize;
+    std::vector<Edge> forestEdges;
+    std::vector<Edge> pending;
+    std::vector<bool> seen;
+    uint32_t nodesCount = 0;
+};
+} // namespace Graphs::Algorithm
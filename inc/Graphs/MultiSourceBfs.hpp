@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <Graphs/Algorithm.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Breadth-first searches from many sources at once (MS-BFS, Then et al.).
+        Sources are processed in batches of 64 or 256, every node keeps bit
+        masks of the batch sources that have seen it and that visit it in the
+        current level, so a single scan of the adjacency per level advances
+        all searches of the batch. For every reached node the visitor is
+        called with the index of the source in the sources list, the node id
+        and its distance, level by level within a batch.
+*/
+class MultiSourceBfs : public AlgorithmFunctor
+{
+    public:
+    enum class Width
+    {
+        bits64 = 64,
+        bits256 = 256
+    };
+
+    using Visitor = std::function<void(uint32_t sourceIndex, NodeId node, uint32_t distance)>;
+
+    MultiSourceBfs(std::vector<NodeId> sources, Visitor visitor, Width width = Width::bits64)
+        : sources(std::move(sources)), visitor(std::move(visitor)), width(width) {
+        if (not this->visitor)
+        {
+            throw std::invalid_argument{"MS-BFS visitor cannot be empty"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    private:
+    std::vector<NodeId> sources;
+    Visitor visitor;
+    Width width;
+};
+} // namespace Graphs::Algorithm
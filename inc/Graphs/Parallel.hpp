@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Graphs::Parallel
+{
+inline uint32_t resolveThreadsCount(uint32_t requested) {
+    if (requested != 0)
+    {
+        return requested;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/*
+        Splits [begin, end) into one contiguous chunk per thread and calls
+        body(chunkBegin, chunkEnd, threadIndex) for each of them. The calling
+        thread processes the first chunk, so a single thread runs inline.
+*/
+template <class Body>
+void forEachChunk(uint64_t begin, uint64_t end, uint32_t threadsCount, Body body) {
+    threadsCount = static_cast<uint32_t>(std::min<uint64_t>(resolveThreadsCount(threadsCount), std::max<uint64_t>(end - begin, 1)));
+    const uint64_t chunk = (end - begin + threadsCount - 1) / threadsCount;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (uint32_t i = 1; i < threadsCount; i++)
+    {
+        auto chunkBegin = std::min(end, begin + i * chunk);
+        auto chunkEnd = std::min(end, chunkBegin + chunk);
+        workers.emplace_back(body, chunkBegin, chunkEnd, i);
+    }
+    body(begin, std::min(end, begin + chunk), 0u);
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/*
+        Like forEachChunk, but threads take chunks of at most grain elements
+        from a shared counter until [begin, end) is exhausted, which balances
+        loops whose iterations differ a lot in cost.
+*/
+template <class Body>
+void forEachDynamicChunk(uint64_t begin, uint64_t end, uint64_t grain, uint32_t threadsCount, Body body) {
+    std::atomic<uint64_t> next = begin;
+    const uint64_t chunksCount = (end - begin + grain - 1) / grain;
+    forEachChunk(0, chunksCount, threadsCount, [&next, &body, end, grain](uint64_t, uint64_t, uint32_t thread) {
+        for (auto chunkBegin = next.fetch_add(grain); chunkBegin < end; chunkBegin = next.fetch_add(grain))
+        {
+            body(chunkBegin, std::min(end, chunkBegin + grain), thread);
+        }
+    });
+}
+
+/*
+        Sorts one contiguous chunk per thread, then merges neighboring runs
+        pairwise, all pairs of a round in parallel. Not stable. Inputs below
+        minimumChunk elements per thread use fewer threads.
+*/
+template <class Iterator, class Compare>
+void sort(Iterator begin, Iterator end, uint32_t threadsCount, Compare compare) {
+    constexpr uint64_t minimumChunk = 1 << 14;
+    const auto size = static_cast<uint64_t>(end - begin);
+    threadsCount = static_cast<uint32_t>(std::clamp<uint64_t>(size / minimumChunk, 1, resolveThreadsCount(threadsCount)));
+    const uint64_t chunk = (size + threadsCount - 1) / threadsCount;
+
+    forEachChunk(0, size, threadsCount, [begin, &compare](uint64_t chunkBegin, uint64_t chunkEnd, uint32_t) {
+        std::sort(begin + chunkBegin, begin + chunkEnd, compare);
+    });
+    for (auto width = chunk; width < size; width *= 2)
+    {
+        const uint64_t pairsCount = (size + 2 * width - 1) / (2 * width);
+        forEachChunk(0, pairsCount, threadsCount, [begin, &compare, size, width](uint64_t pairsBegin, uint64_t pairsEnd, uint32_t) {
+            for (auto pair = pairsBegin; pair < pairsEnd; pair++)
+            {
+                auto first = pair * 2 * width;
+                auto middle = std::min(size, first + width);
+                std::inplace_merge(begin + first, begin + middle, begin + std::min(size, first + 2 * width), compare);
+            }
+        });
+    }
+}
+} // namespace Graphs::Parallel
@@ -2,6 +2,7 @@
 
 // libraries
 #include <cstdint>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -23,28 +24,48 @@ uint32_t find_index(const std::vector<Data::coord>& nodes, uint32_t x, uint32_t
 /*
         Class representing a map of binary pixels.
         Used to create a graph of pathways between adjacent pixels.
+
+        The map is kept in a single contiguous buffer, either one byte per
+        pixel, or one bit per pixel with every row padded to whole 64-bit
+        words. Text maps (space separated pixels, one row per line) and
+        binary maps (".pmb" extension) are supported.
 */
 class Pixel_map
 {
     public:
+    enum class Storage
+    {
+        bytes = 0,
+        bits
+    };
+
     /* Constructors */
-    Pixel_map(std::string file_path);
+    Pixel_map(std::string file_path, Storage storage = Storage::bytes);
     Pixel_map(Pixel_map& p) = delete;
     Pixel_map(Pixel_map&& p) = delete;
 
     /* Interface */
     void print_area_map();
+    void save_binary(std::string file_path) const;
 
     uint32_t get_rows() const;
     uint32_t get_columns() const;
     uint32_t get_field(uint32_t x, uint32_t y) const;
-
-    /* Destructor */
-    ~Pixel_map();
+    Storage get_storage() const;
 
     private:
+    /* Private methods */
+    void load_text(std::ifstream& file);
+    void load_binary(std::ifstream& file);
+    void set_pixel(uint32_t x, uint32_t y, uint8_t value);
+    void resize_for_rows(uint32_t rows_count);
+
     /* Private variables */
-    uint8_t** area_map;
+    Storage storage;
+
+    std::vector<uint8_t> pixels;
+    std::vector<uint64_t> packed_pixels;
+    uint32_t words_per_row;
 
     uint32_t rows;
     uint32_t columns;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/CsrGraph.hpp>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Graphs
+{
+/*
+        Node orderings that place nodes walked together next to each other.
+        Ordering::degree sorts by non-increasing degree, which packs the hubs
+        touched by most walks into a few cache lines. Ordering::reverseCuthillMcKee
+        numbers every component by BFS from a pseudo-peripheral node, visiting
+        neighbors by increasing degree, and reverses the result, which keeps
+        neighbors at close ids (a low matrix bandwidth). Ordering::gorder is
+        the greedy Gorder of Wei et al.: the next node is the one sharing
+        most edges and common neighbors with the last window placed nodes,
+        with hubs above sqrt(n) neighbors not expanded into common neighbors.
+        All of them work on the undirected form of the graph.
+*/
+enum class Ordering
+{
+    degree = 0,
+    reverseCuthillMcKee,
+    gorder
+};
+
+/*
+        Graph relabeled to dense ids in the new order, keeping weights and
+        metadata. permutation maps an original node id to its new id (noNode
+        for ids not in the graph) and inverse maps a new id back.
+*/
+struct Relabeling
+{
+    static constexpr NodeId noNode = std::numeric_limits<NodeId>::max();
+
+    CsrGraph graph;
+    std::vector<NodeId> permutation;
+    std::vector<NodeId> inverse;
+
+    /* Per-node values of the relabeled graph indexed by original node id */
+    template <class T>
+    std::vector<T> restore(std::span<const T> values, const T& missing = {}) const {
+        std::vector<T> restored(permutation.size(), missing);
+        for (NodeId node = 0; node < inverse.size() and node < values.size(); node++)
+        {
+            restored[inverse[node]] = values[node];
+        }
+        return restored;
+    }
+};
+
+Relabeling reorder(const Graph&, Ordering, uint32_t window = 5);
+} // namespace Graphs
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*
+        Triangles of the undirected simple form of a graph. Per-node values
+        are indexed by node id, ids not present in the graph have 0. Local
+        clustering of a node with degree d and t triangles is 2t / (d(d - 1)),
+        0 below degree 2; averageClustering averages it over all nodes and
+        transitivity is 3 * triangles / wedges.
+*/
+struct TriangleResult
+{
+    uint64_t triangles = 0;
+    std::vector<uint64_t> nodeTriangles;
+    std::vector<double> clustering;
+    double averageClustering = 0;
+    double transitivity = 0;
+};
+
+/*
+        Every edge is oriented from the endpoint of lower degree (ties by id)
+        to the higher one, which bounds out-degrees by sqrt(2m) and finds each
+        triangle exactly once, as the intersection of the out-neighbors of
+        both endpoints of an oriented edge. Kernel::merge intersects sorted
+        lists in fixed blocks of 8 compared all-pairs, a shape the compiler
+        vectorizes, with a scalar tail. Kernel::bitmap keeps out-neighbors in
+        a BitMatrix and ANDs whole rows, which pays off on small dense graphs;
+        Kernel::automatic picks it when the matrix is small and rows are short
+        compared to the average degree. Nodes are split between threads.
+*/
+class TriangleCounting : public AlgorithmFunctor
+{
+    public:
+    enum class Kernel
+    {
+        automatic = 0,
+        merge,
+        bitmap
+    };
+
+    TriangleCounting(std::shared_ptr<TriangleResult> resultContainer, Kernel kernel = Kernel::automatic, uint32_t threadsCount = 0)
+        : result(std::move(resultContainer)), kernel(kernel), threadsCount(threadsCount) {
+        if (not result)
+        {
+            throw std::invalid_argument{"Triangle result cannot be null"};
+        }
+    }
+
+    void operator()(const Graphs::Graph&) override;
+
+    static constexpr uint32_t maxBitmapNodes = 1u << 14;
+
+    private:
+    std::shared_ptr<TriangleResult> result = {};
+    Kernel kernel;
+    uint32_t threadsCount;
+};
+} // namespace Graphs::Algorithm
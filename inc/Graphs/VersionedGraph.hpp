@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/DynamicGraph.hpp>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace Graphs
+{
+/* Immutable topology published by VersionedGraph, node ids map back through graph.originalId() */
+struct Snapshot
+{
+    uint64_t version;
+    CsrGraph graph;
+};
+
+/*
+        Graph shared between ingest and analytics threads. Writers stage
+        mutations in a DynamicGraph and make them visible in one step with
+        publish(), which swaps in a new CSR snapshot through an atomic
+        pointer. Readers announce the current epoch before loading the
+        pointer, so taking a snapshot never locks nor waits for a writer.
+        A replaced snapshot is freed by the writer once every reader that
+        could still see it has released its guard.
+        All readers must be destroyed before the VersionedGraph.
+*/
+class VersionedGraph
+{
+    public:
+    class Reader;
+
+    /* Keeps the snapshot alive for as long as the guard exists */
+    class ReadGuard
+    {
+        public:
+        ReadGuard(ReadGuard&) = delete;
+        ~ReadGuard();
+
+        const Snapshot& operator*() const {
+            return snapshot;
+        }
+
+        const Snapshot* operator->() const {
+            return &snapshot;
+        }
+
+        private:
+        friend class Reader;
+        ReadGuard(Reader&, const Snapshot&);
+
+        Reader& reader;
+        const Snapshot& snapshot;
+    };
+
+    /*
+            Registration of one reading thread, guards of a reader may be
+            nested. Guards refer to their reader, so it cannot be moved.
+    */
+    class Reader
+    {
+        public:
+        Reader(Reader&) = delete;
+        Reader(Reader&&) = delete;
+        ~Reader();
+
+        ReadGuard read();
+
+        private:
+        friend class VersionedGraph;
+        Reader(VersionedGraph&, std::size_t);
+
+        VersionedGraph* owner;
+        std::size_t slot;
+        uint32_t depth = 0;
+    };
+
+    VersionedGraph(const Graph&, uint32_t = 64);
+
+    VersionedGraph(VersionedGraph&) = delete;
+    ~VersionedGraph();
+
+    /* Throws when all reader slots are taken */
+    Reader reader();
+
+    void setEdges(std::span<const EdgeInfo>);
+    void removeEdges(std::span<const EdgeInfo>);
+    void addNodes(uint32_t);
+    void removeNode(NodeId);
+
+    /* Publishes the staged mutations and returns the version readers will see */
+    uint64_t publish();
+
+    uint64_t version() const;
+    std::size_t retiredAmount() const;
+
+    private:
+    static constexpr uint64_t idle = std::numeric_limits<uint64_t>::max();
+
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<bool> used = false;
+        std::atomic<uint64_t> epoch = idle;
+    };
+
+    struct Retired
+    {
+        const Snapshot* snapshot;
+        uint64_t epoch;
+    };
+
+    const Snapshot& pin(std::size_t, bool);
+    void unpin(std::size_t);
+    void reclaim();
+
+    mutable std::mutex writerMutex;
+    DynamicGraph staging;
+    uint64_t publishedRevision;
+    std::vector<Retired> retired;
+
+    std::unique_ptr<ReaderSlot[]> slots;
+    uint32_t slotsCount;
+    std::atomic<const Snapshot*> current;
+    std::atomic<uint64_t> globalEpoch = 1;
+    std::atomic<uint64_t> publishedVersion = 0;
+};
+} // namespace Graphs
@@ -7,8 +7,11 @@
 #include <Graphs/AdjList.hpp>
 #include <Graphs/AdjMatrix.hpp>
 #include <iostream>
-#include <regex>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
 #include <sstream>
+#include <tuple>
 
 namespace
 {
@@ -35,6 +38,72 @@ void insertNeighborIfApplicable(auto checker, auto inserter, Data::coord coordsT
         inserter(coordsToInsert);
     }
 }
+
+/*
+        Destinations of a batch of edges grouped by the storage index of their
+        source. Only the sources touched by the batch get a group, so the cost
+        follows the batch size rather than the graph size. Edges with an
+        unknown endpoint are skipped.
+*/
+struct SourceBuckets
+{
+    SourceBuckets(std::pmr::memory_resource* arena)
+        : offsets(arena), destinations(arena), sourceIds(arena), sourceIndices(arena) {}
+
+    std::pmr::vector<std::size_t> offsets;
+    std::pmr::vector<Graphs::NodeId> destinations;
+    std::pmr::vector<Graphs::NodeId> sourceIds;
+    std::pmr::vector<uint32_t> sourceIndices;
+
+    std::size_t size() const {
+        return sourceIds.size();
+    }
+
+    std::span<const Graphs::NodeId> of(std::size_t bucket) const {
+        return {destinations.data() + offsets[bucket], destinations.data() + offsets[bucket + 1]};
+    }
+};
+
+SourceBuckets bucketBySource(const std::map<Graphs::NodeId, uint32_t>& nodeMap,
+                             std::span<const Graphs::EdgeInfo> edges,
+                             std::pmr::memory_resource* arena) {
+    struct Arc
+    {
+        uint32_t sourceIndex;
+        Graphs::NodeId source;
+        Graphs::NodeId destination;
+    };
+
+    std::pmr::vector<Arc> arcs(arena);
+    arcs.reserve(edges.size());
+    for (const auto& edge : edges)
+    {
+        auto sourceMapping = nodeMap.find(edge.source);
+        if (sourceMapping == nodeMap.end() or not nodeMap.contains(edge.destination))
+        {
+            continue;
+        }
+        arcs.push_back({sourceMapping->second, edge.source, edge.destination});
+    }
+    std::ranges::sort(arcs, [](const Arc& lhs, const Arc& rhs) {
+        return std::tie(lhs.sourceIndex, lhs.destination) < std::tie(rhs.sourceIndex, rhs.destination);
+    });
+
+    SourceBuckets buckets(arena);
+    buckets.destinations.reserve(arcs.size());
+    for (std::size_t i = 0; i < arcs.size(); i++)
+    {
+        if (i == 0 or arcs[i].sourceIndex != arcs[i - 1].sourceIndex)
+        {
+            buckets.offsets.push_back(i);
+            buckets.sourceIds.push_back(arcs[i].source);
+            buckets.sourceIndices.push_back(arcs[i].sourceIndex);
+        }
+        buckets.destinations.push_back(arcs[i].destination);
+    }
+    buckets.offsets.push_back(arcs.size());
+    return buckets;
+}
 } // namespace
 
 namespace Graphs
@@ -47,41 +116,47 @@ void AdjList::buildFromLstFile(const std::string& filePath) {
         throw std::runtime_error("Error opening file");
     }
 
-    auto fileContent = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
-
-    std::regex nodeRegex("[0-9]*: ([]+))");
-    std::smatch nodeMatch;
-
-    auto parseLine = [](const std::string& line) {
-        AdjList::Neighbors neighbors;
+    // one scratch list is reused, the pool then gets a single exact-size block per node
+    std::vector<uint32_t> neighbors;
+    auto parseLine = [&neighbors](const std::string& line) {
+        neighbors.clear();
         std::stringstream stream(line);
-        std::string value;
+        uint32_t value;
 
-        while (std::getline(stream, value, ' '))
+        while (stream >> value)
         {
-            neighbors.emplace_back(static_cast<uint32_t>(std::stoi(value)));
+            neighbors.emplace_back(value);
         }
-        return neighbors;
+        std::ranges::sort(neighbors);
     };
 
-    using regItr = std::sregex_iterator;
-
-    for (auto itr = regItr(fileContent.begin(), fileContent.end(), nodeRegex); itr != regItr(); ++itr)
+    std::string line;
+    while (std::getline(file, line))
     {
-        std::smatch match = *itr;
-        nodes.emplace_back(parseLine(match.str()));
+        auto separator = line.find(':');
+        // lines starting with '#' carry metadata of generated graphs
+        if (line.empty() or line.front() == '#' or separator == std::string::npos)
+        {
+            continue;
+        }
+
+        auto nodeId = static_cast<NodeId>(std::stoul(line.substr(0, separator)));
+        nodeMap.insert(std::pair<uint32_t, uint32_t>(nodeId, nodes.size()));
+        parseLine(line.substr(separator + 1));
+        nodes.emplace_back(neighbors.begin(), neighbors.end());
     }
 }
 
-AdjList::AdjList(std::string filePath) {
+AdjList::AdjList(std::string filePath, std::pmr::memory_resource* upstream) : neighborPool(upstream) {
     auto extension = std::filesystem::path(filePath).extension().string();
 
-    assert(extension == "lst");
+    assert(extension == ".lst");
 
     buildFromLstFile(filePath);
+    rebuildDegrees();
 }
 
-AdjList::AdjList(const Graph& graph) {
+AdjList::AdjList(const Graph& graph, std::pmr::memory_resource* upstream) : neighborPool(upstream) {
     nodes.resize(graph.nodesAmount());
 
     for (uint32_t i = 0; i < nodes.size(); i++)
@@ -98,6 +173,15 @@ AdjList::AdjList(const Graph& graph) {
         }
         nodeMap.insert(std::pair<uint32_t, uint32_t>(i + 1, i));
     }
+    rebuildDegrees();
+}
+
+void AdjList::rebuildDegrees() {
+    degreeTable.resize(nodeMap.empty() ? 0 : static_cast<std::size_t>(nodeMap.rbegin()->first) + 1);
+    for (const auto& [nodeId, index] : nodeMap)
+    {
+        degreeTable.set(nodeId, static_cast<uint32_t>(nodes[index].size()));
+    }
 }
 
 /*AdjList::AdjList(const Data::Pixel_map& map) {
@@ -157,7 +241,15 @@ uint32_t AdjList::nodesAmount() const {
 }
 
 uint32_t AdjList::nodeDegree(NodeId node) const {
-    return nodes[nodeMap.find(node)->second].size();
+    return degreeTable.degree(node);
+}
+
+std::span<const uint32_t> AdjList::degrees() const {
+    return degreeTable.all();
+}
+
+uint32_t AdjList::maxDegree() const {
+    return degreeTable.maxDegree();
 }
 
 std::vector<NodeId> AdjList::getNeighborsOf(NodeId node) const {
@@ -167,7 +259,17 @@ std::vector<NodeId> AdjList::getNeighborsOf(NodeId node) const {
         return {};
     }
 
-    return nodes[nodeMapping->second];
+    const auto& stored = nodes[nodeMapping->second];
+    if (pendingRemovals == 0)
+    {
+        return {stored.begin(), stored.end()};
+    }
+
+    std::vector<NodeId> neighbors;
+    std::ranges::copy_if(stored, std::back_inserter(neighbors), [this](NodeId neighbor) {
+        return neighbor >= removedIds.size() or not removedIds[neighbor];
+    });
+    return neighbors;
 }
 
 // // algorytmy LF i SL  tworz� mapy posegregowane w odpowiedniaj kolejno�ci po
@@ -355,9 +457,8 @@ std::vector<NodeId> AdjList::getNeighborsOf(NodeId node) const {
 // algorytmu greedy i zwr�cenie ilo�ci u�ytych kolor�w
 // }
 
-void AdjList::addNeighborAndSortRange(Neighbors& range, NodeId tgtNeighbor) {
-    range.emplace_back(tgtNeighbor);
-    std::ranges::sort(range);
+void AdjList::addNeighborToSortedRange(Neighbors& range, NodeId tgtNeighbor) {
+    range.insert(std::ranges::upper_bound(range, tgtNeighbor), tgtNeighbor);
 }
 
 void AdjList::setEdge(const EdgeInfo& edge) {
@@ -369,14 +470,25 @@ void AdjList::setEdge(const EdgeInfo& edge) {
         return;
     }
 
-    addNeighborAndSortRange(nodes[sourceNodeMapping->second], edge.destination);
-    // TODO: addNeighborAndSortRange(nodes[destinationNodeMapping->second], edge.source);
+    addNeighborToSortedRange(nodes[sourceNodeMapping->second], edge.destination);
+    // TODO: addNeighborToSortedRange(nodes[destinationNodeMapping->second], edge.source);
+    degreeTable.increment(edge.source);
+    markModified();
+}
+
+/* Neighbors not yet purged by compact() are not counted */
+uint32_t AdjList::liveDegree(const Neighbors& neighbors) const {
+    if (pendingRemovals == 0)
+    {
+        return static_cast<uint32_t>(neighbors.size());
+    }
+    return static_cast<uint32_t>(std::ranges::count_if(neighbors, [this](NodeId neighbor) {
+        return neighbor >= removedIds.size() or not removedIds[neighbor];
+    }));
 }
 
 void AdjList::removeNeighborFromRange(Neighbors& range, NodeId tgtNeighbor) {
-    std::ranges::remove_if(range, [tgtNeighbor](auto& neighbor) {
-        return neighbor == tgtNeighbor;
-    });
+    std::erase(range, tgtNeighbor);
 }
 
 void AdjList::removeEdge(const EdgeInfo& edge) {
@@ -388,17 +500,61 @@ void AdjList::removeEdge(const EdgeInfo& edge) {
         return;
     }
 
-    removeNeighborFromRange(nodes[sourceNodeMapping->second], edge.destination);
+    auto& neighbors = nodes[sourceNodeMapping->second];
+    removeNeighborFromRange(neighbors, edge.destination);
+    degreeTable.set(edge.source, liveDegree(neighbors));
+    markModified();
+}
+
+/*
+        Sorts the batch by source and destination and merges the new
+        destinations of every touched node with its sorted neighbors once,
+        instead of re-sorting the neighbors after every single inserted edge.
+*/
+void AdjList::setEdges(std::span<const EdgeInfo> edges) {
+    std::pmr::monotonic_buffer_resource arena(neighborPool.upstream_resource());
+    auto buckets = bucketBySource(nodeMap, edges, &arena);
+
+    for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+    {
+        auto added = buckets.of(bucket);
+        auto& neighbors = nodes[buckets.sourceIndices[bucket]];
+        auto previousSize = static_cast<std::ptrdiff_t>(neighbors.size());
+        neighbors.insert(neighbors.end(), added.begin(), added.end());
+        std::inplace_merge(neighbors.begin(), neighbors.begin() + previousSize, neighbors.end());
+        degreeTable.set(buckets.sourceIds[bucket], liveDegree(neighbors));
+    }
+    markModified();
+}
+
+void AdjList::removeEdges(std::span<const EdgeInfo> edges) {
+    std::pmr::monotonic_buffer_resource arena(neighborPool.upstream_resource());
+    auto buckets = bucketBySource(nodeMap, edges, &arena);
+
+    for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+    {
+        auto removed = buckets.of(bucket);
+        auto& neighbors = nodes[buckets.sourceIndices[bucket]];
+        std::erase_if(neighbors, [&removed](NodeId neighbor) {
+            return std::ranges::binary_search(removed, neighbor);
+        });
+        degreeTable.set(buckets.sourceIds[bucket], liveDegree(neighbors));
+    }
+    markModified();
 }
 
 void AdjList::addNodes(uint32_t nodesAmount) {
-    auto highestId = nodeMap.rbegin()->first;
+    // ids of removed nodes may be handed out again, so stale arcs to them go first
+    compact();
+    auto highestId = nodeMap.empty() ? 0 : nodeMap.rbegin()->first;
 
     for (uint32_t i = 1; i <= nodesAmount; i++)
     {
-        nodeMap[highestId + i] = nodes.size() + i;
+        nodeMap[highestId + i] = nodes.size() + i - 1;
     }
     nodes.resize(nodes.size() + nodesAmount);
+    degreeTable.resize(static_cast<std::size_t>(nodeMap.rbegin()->first) + 1);
+    markModified();
 }
 
 void AdjList::removeNode(NodeId node) {
@@ -409,10 +565,60 @@ void AdjList::removeNode(NodeId node) {
         return;
     }
 
-    std::ranges::remove_if(nodes, [this, &nodeMapping](auto& neighbors) {
-        return neighbors == nodes[nodeMapping->second];
-    });
+    auto& neighbors = nodes[nodeMapping->second];
+    for (auto itr = neighbors.begin(); itr != neighbors.end(); itr = std::upper_bound(itr, neighbors.end(), *itr))
+    {
+        auto neighbor = *itr;
+        auto neighborMapping = nodeMap.find(neighbor);
+        if (neighborMapping == nodeMap.end() or neighbor == node)
+        {
+            continue;
+        }
+        // the back-arcs stay in place until compact(), only the degree follows the removal
+        const auto& backArcs = nodes[neighborMapping->second];
+        auto [first, last] = std::ranges::equal_range(backArcs, node);
+        degreeTable.set(neighbor, degreeTable.degree(neighbor) - static_cast<uint32_t>(last - first));
+    }
+    // swapping with a fresh list would mix allocators, the block goes back to the pool instead
+    neighbors.clear();
+    neighbors.shrink_to_fit();
+
     nodeMap.erase(nodeMapping);
+    degreeTable.set(node, 0);
+    if (node >= removedIds.size())
+    {
+        removedIds.resize(static_cast<std::size_t>(node) + 1, false);
+    }
+    removedIds[node] = true;
+    pendingRemovals++;
+    markModified();
+}
+
+/*
+        Moves the lists of live nodes into consecutive storage in id order,
+        dropping arcs into removed nodes on the way.
+*/
+void AdjList::compact() {
+    if (pendingRemovals == 0)
+    {
+        return;
+    }
+
+    std::pmr::vector<Neighbors> compacted(&neighborPool);
+    compacted.reserve(nodeMap.size());
+    for (auto& [nodeId, index] : nodeMap)
+    {
+        auto& neighbors = compacted.emplace_back(std::move(nodes[index]));
+        std::erase_if(neighbors, [this](NodeId neighbor) {
+            return neighbor < removedIds.size() and removedIds[neighbor];
+        });
+        degreeTable.set(nodeId, static_cast<uint32_t>(neighbors.size()));
+        index = static_cast<uint32_t>(compacted.size() - 1);
+    }
+
+    nodes = std::move(compacted);
+    removedIds.clear();
+    pendingRemovals = 0;
 }
 
 EdgeInfo AdjList::findEdge(const EdgeInfo& edge) const {
@@ -424,9 +630,10 @@ EdgeInfo AdjList::findEdge(const EdgeInfo& edge) const {
         return {edge.source, edge.destination, std::nullopt};
     }
 
-    auto neighbor = std::ranges::find(nodes[edge.source], edge.destination);
+    const auto& neighbors = nodes[source->second];
+    auto neighbor = std::ranges::find(neighbors, edge.destination);
 
-    if (neighbor == std::end(nodes[edge.source]))
+    if (neighbor == std::end(neighbors))
     {
         return {edge.source, edge.destination, std::nullopt};
     }
@@ -54,22 +54,43 @@ EdgeParsingResult findEdgeInFileContent(const std::string& fileContent,
 }
 } // namespace
 
+/* New rows get the next id after the highest one ever assigned */
+void AdjMatrix::appendRow(Row row) {
+    rowNodes.push_back(static_cast<NodeId>(nodeRows.size()));
+    nodeRows.push_back(static_cast<uint32_t>(matrix.size()));
+    matrix.emplace_back(std::move(row));
+}
+
+uint32_t AdjMatrix::rowOf(NodeId node) const {
+    return node < nodeRows.size() ? nodeRows[node] : removed;
+}
+
 void AdjMatrix::resizeMatrixToFitNodes(uint32_t nodesCount) {
     assert(nodesCount > matrix.size());
 
-    auto nodesAmountDiff = nodesCount - matrix.size();
-    auto maxNodeItr = nodeIndexMapping.rbegin();
-    auto maxNodeId = maxNodeItr != nodeIndexMapping.rend() ? maxNodeItr->first : 0;
-
-    for (uint32_t i = 1; i <= nodesAmountDiff; i++)
+    for (auto& row : matrix)
     {
-        nodeIndexMapping.insert(std::make_pair(maxNodeId + i, matrix.size() + i));
+        row.resize(nodesCount);
     }
+    while (matrix.size() < nodesCount)
+    {
+        appendRow(Row(nodesCount, 0, matrix.get_allocator()));
+    }
+    degreeTable.resize(nodeRows.size());
+}
 
-    matrix.resize(nodesCount);
-    for (auto& row : matrix)
+void AdjMatrix::rebuildDegrees() {
+    degreeTable.resize(nodeRows.size());
+    for (uint32_t i = 0; i < matrix.size(); i++)
     {
-        row.resize(nodesCount);
+        if (rowNodes[i] == removed)
+        {
+            continue;
+        }
+        auto degree = std::ranges::count_if(matrix[i], [](auto elem) {
+            return elem != 0;
+        });
+        degreeTable.set(rowNodes[i], static_cast<uint32_t>(degree));
     }
 }
 
@@ -80,8 +101,8 @@ void AdjMatrix::buildFromMatFile(const std::string& filePath) {
         throw std::runtime_error("Error opening file");
     }
 
-    auto parseLine = [](const auto& line) {
-        Row row;
+    auto parseLine = [this](const auto& line) {
+        Row row(matrix.get_allocator());
         std::stringstream stream(line);
         std::string value;
 
@@ -93,7 +114,6 @@ void AdjMatrix::buildFromMatFile(const std::string& filePath) {
         return row;
     };
 
-    NodeId nodeId = 0;
     while (not file.eof())
     {
         std::string line;
@@ -103,8 +123,7 @@ void AdjMatrix::buildFromMatFile(const std::string& filePath) {
         {
             continue;
         }
-        matrix.emplace_back(parseLine(line));
-        nodeIndexMapping.insert(std::make_pair(nodeId++, matrix.size() - 1));
+        appendRow(parseLine(line));
     }
 }
 
@@ -142,7 +161,7 @@ void AdjMatrix::buildFromGraphMLFile(const std::string& filePath) {
     }
 }
 
-AdjMatrix::AdjMatrix(std::string filePath) {
+AdjMatrix::AdjMatrix(std::string filePath, std::pmr::memory_resource* resource) : matrix(resource) {
     std::filesystem::path path(filePath);
     const auto& extension = path.extension().string();
     assert(extension == ".mat" or extension == ".GRAPHML");
@@ -155,9 +174,10 @@ AdjMatrix::AdjMatrix(std::string filePath) {
     {
         buildFromGraphMLFile(filePath);
     }
+    rebuildDegrees();
 }
 
-AdjMatrix::AdjMatrix(const Graph& graph) {
+AdjMatrix::AdjMatrix(const Graph& graph, std::pmr::memory_resource* resource) : matrix(resource) {
     auto nodesAmount = graph.nodesAmount();
     resizeMatrixToFitNodes(nodesAmount);
 
@@ -168,22 +188,19 @@ AdjMatrix::AdjMatrix(const Graph& graph) {
             matrix[i][j] = graph.findEdge({i, j}).weight.value_or(0);
         }
     }
+    rebuildDegrees();
 }
 
 uint32_t AdjMatrix::nodeDegree(NodeId node) const {
-    if (node >= matrix.size())
-    {
-        return 0;
-    }
+    return degreeTable.degree(node);
+}
 
-    uint32_t degree = 0;
-    std::ranges::for_each(matrix[node], [&degree](auto elem) {
-        if (elem != 0)
-        {
-            degree++;
-        }
-    });
-    return degree;
+std::span<const uint32_t> AdjMatrix::degrees() const {
+    return degreeTable.all();
+}
+
+uint32_t AdjMatrix::maxDegree() const {
+    return degreeTable.maxDegree();
 }
 
 /*void AdjMatrix::saveGraphML(std::string file_path) {
@@ -283,53 +300,114 @@ uint32_t AdjMatrix::nodeDegree(NodeId node) const {
 }*/
 
 void AdjMatrix::setEdge(const EdgeInfo& edge) {
-    if (edge.source < matrix.size() && edge.destination < matrix.size())
+    auto source = rowOf(edge.source);
+    auto destination = rowOf(edge.destination);
+    if (source != removed && destination != removed)
     {
-        this->matrix[edge.source][edge.destination] = 1;
+        auto& cell = this->matrix[source][destination];
+        if (cell == 0)
+        {
+            degreeTable.increment(edge.source);
+        }
+        cell = 1;
+        markModified();
     }
 }
 
 void AdjMatrix::addNodes(uint32_t nodesCount) {
     resizeMatrixToFitNodes(matrix.size() + nodesCount);
+    markModified();
 }
 
 void AdjMatrix::removeEdge(const EdgeInfo& edge) {
-    if (edge.source < matrix.size() and edge.destination < matrix.size())
+    auto source = rowOf(edge.source);
+    auto destination = rowOf(edge.destination);
+    if (source != removed and destination != removed)
     {
-        matrix[edge.source][edge.destination] = 0;
+        auto& cell = matrix[source][destination];
+        if (cell != 0)
+        {
+            degreeTable.decrement(edge.source);
+        }
+        cell = 0;
+        markModified();
     }
 }
 
 void AdjMatrix::removeNode(NodeId node) {
-    if (node >= matrix.size())
+    auto nodeRow = rowOf(node);
+    if (nodeRow == removed)
     {
         return;
     }
 
-    auto nodeIndex = nodeIndexMapping[node];
+    for (uint32_t i = 0; i < matrix.size(); i++)
+    {
+        if (matrix[i][nodeRow] != 0)
+        {
+            degreeTable.decrement(rowNodes[i]);
+            matrix[i][nodeRow] = 0;
+        }
+    }
+    std::ranges::fill(matrix[nodeRow], 0);
+    degreeTable.set(node, 0);
 
-    constexpr uint32_t offset = 1;
-    std::ranges::subrange(std::next(nodeIndexMapping.begin(), node + offset), nodeIndexMapping.end())
-        | std::views::transform([nodeIndex](auto elem) {
-              return std::pair(elem.first, elem.second - 1);
-          });
+    rowNodes[nodeRow] = removed;
+    nodeRows[node] = removed;
+    tombstones++;
+    markModified();
+}
 
-    matrix.erase(matrix.begin() + nodeIndex);
-    for (auto& row : matrix)
+void AdjMatrix::compact() {
+    if (tombstones == 0)
     {
-        row.erase(row.begin() + nodeIndex);
+        return;
     }
+
+    std::vector<uint32_t> liveRows;
+    liveRows.reserve(matrix.size() - tombstones);
+    for (uint32_t i = 0; i < matrix.size(); i++)
+    {
+        if (rowNodes[i] != removed)
+        {
+            liveRows.push_back(i);
+        }
+    }
+
+    std::pmr::vector<Row> compacted(liveRows.size(), Row(liveRows.size(), matrix.get_allocator()), matrix.get_allocator());
+    std::vector<NodeId> compactedNodes(liveRows.size());
+    for (uint32_t i = 0; i < liveRows.size(); i++)
+    {
+        const auto& row = matrix[liveRows[i]];
+        for (uint32_t j = 0; j < liveRows.size(); j++)
+        {
+            compacted[i][j] = row[liveRows[j]];
+        }
+        compactedNodes[i] = rowNodes[liveRows[i]];
+        nodeRows[compactedNodes[i]] = i;
+    }
+
+    matrix = std::move(compacted);
+    rowNodes = std::move(compactedNodes);
+    tombstones = 0;
 }
 
 std::string AdjMatrix::show() const {
     std::stringstream out;
-    out << "\nNodes amount = " << matrix.size() << "\n";
+    out << "\nNodes amount = " << nodesAmount() << "\n";
     out << "[\n";
     for (uint32_t i = 0; i < matrix.size(); i++)
     {
+        if (rowNodes[i] == removed)
+        {
+            continue;
+        }
         for (uint32_t j = 0; j < matrix[i].size(); j++)
         {
-            out << this->matrix[i][j] << ", ";
+            if (rowNodes[j] != removed)
+            {
+                out << this->matrix[i][j] << ", ";
+            }
         }
         out << "\n";
     }
@@ -351,40 +429,47 @@ std::string AdjMatrix::show() const {
 }*/
 
 uint32_t AdjMatrix::nodesAmount() const {
-    return matrix.size();
+    return matrix.size() - tombstones;
 }
 
 EdgeInfo AdjMatrix::findEdge(const EdgeInfo& edge) const {
-    auto sourceIterator = std::ranges::find_if(nodeIndexMapping, [edge](const auto& elem) {
-        return elem.first == edge.source;
-    });
-    auto destinationIterator = std::ranges::find_if(nodeIndexMapping, [edge](const auto& elem) {
-        return elem.first == edge.destination;
-    });
+    auto source = rowOf(edge.source);
+    auto destination = rowOf(edge.destination);
 
-    if (sourceIterator == nodeIndexMapping.end() or destinationIterator == nodeIndexMapping.end())
+    if (source == removed or destination == removed)
     {
         return {edge.source, edge.destination, std::nullopt};
     }
-    const auto& weight = matrix[sourceIterator->second][destinationIterator->second];
+    const auto& weight = matrix[source][destination];
     return {edge.source, edge.destination, weight == 0 ? std::nullopt : std::make_optional(weight)};
 }
 
 std::vector<NodeId> AdjMatrix::getNodeIds() const {
     std::vector<NodeId> nodeIds;
-    nodeIndexMapping | std::views::keys | std::views::transform([&nodeIds](auto elem) {
-        return nodeIds.emplace_back(elem);
-    });
+    nodeIds.reserve(nodesAmount());
+    for (NodeId nodeId = 0; nodeId < nodeRows.size(); nodeId++)
+    {
+        if (nodeRows[nodeId] != removed)
+        {
+            nodeIds.push_back(nodeId);
+        }
+    }
     return nodeIds;
 }
 
 std::vector<NodeId> AdjMatrix::getNeighborsOf(NodeId node) const {
     std::vector<NodeId> neighbors;
-    for (uint32_t i = 0; i < matrix[node].size(); i++)
+    auto nodeRow = rowOf(node);
+    if (nodeRow == removed)
+    {
+        return neighbors;
+    }
+
+    for (uint32_t i = 0; i < matrix[nodeRow].size(); i++)
     {
-        if (matrix[node][i] != 0)
+        if (matrix[nodeRow][i] != 0)
         {
-            neighbors.push_back(i);
+            neighbors.push_back(rowNodes[i]);
         }
     }
     return neighbors;
@@ -1,13 +1,157 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <Graphs/AdjMatrix.hpp>
 #include <Graphs/Benchmark.hpp>
+#include <Graphs/BreadthFirstSearch.hpp>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/EdgeColoring.hpp>
+#include <Graphs/MaxFlow.hpp>
+#include <Graphs/Memory.hpp>
+#include <Graphs/Parallel.hpp>
+#include <Graphs/Reordering.hpp>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <vector>
 
-void Graph::Benchmark::run(Graphs::Graph& graph,
-                           std::string identifier,
-                           std::string file_path,
-                           uint16_t iterations,
-                           Mode mode,
-                           bool bench_log,
-                           bool alg_log) {
+namespace
+{
+/*
+        Heap allocations made through the global operator new while a
+        HeapCounter is alive. Counting there catches every container, not
+        only the ones routed through a pmr resource.
+*/
+std::atomic<bool> counting_heap = false;
+std::atomic<uint64_t> heap_allocations = 0;
+std::atomic<uint64_t> heap_bytes = 0;
+
+struct HeapCounter
+{
+    HeapCounter() {
+        heap_allocations = 0;
+        heap_bytes = 0;
+        counting_heap = true;
+    }
+
+    ~HeapCounter() {
+        counting_heap = false;
+    }
+
+    HeapCounter(HeapCounter&) = delete;
+};
+} // namespace
+
+// replaced for the whole program, array and nothrow forms forward to these by default
+void* operator new(std::size_t bytes) {
+    if (counting_heap.load(std::memory_order_relaxed))
+    {
+        heap_allocations.fetch_add(1, std::memory_order_relaxed);
+        heap_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    for (;;)
+    {
+        if (auto* pointer = std::malloc(bytes == 0 ? 1 : bytes))
+        {
+            return pointer;
+        }
+        auto handler = std::get_new_handler();
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace
+{
+Graphs::Algorithm::ColorId count_colors(const Graphs::Algorithm::ColoringResult& coloring) {
+    Graphs::Algorithm::ColorId colors = 0;
+    for (const auto& [node, color] : coloring)
+    {
+        colors = std::max(colors, color + 1);
+    }
+    return colors;
+}
+
+Graphs::NodeId highest_degree_node(const Graphs::CsrGraph& graph) {
+    Graphs::NodeId hub = 0;
+    for (Graphs::NodeId node = 1; node < graph.nodesAmount(); node++)
+    {
+        if (graph.nodeDegree(node) > graph.nodeDegree(hub))
+        {
+            hub = node;
+        }
+    }
+    return hub;
+}
+
+/* Forwards the graph interface of a CSR graph, so algorithms cannot recognize the backend behind it */
+class InterfaceOnly : public Graphs::Graph
+{
+    public:
+    InterfaceOnly(const Graphs::CsrGraph& graph) : graph(graph) {}
+
+    Graphs::EdgeInfo findEdge(const Graphs::EdgeInfo& edge) const override {
+        return graph.findEdge(edge);
+    }
+
+    uint32_t nodesAmount() const override {
+        return graph.nodesAmount();
+    }
+
+    uint32_t nodeDegree(Graphs::NodeId node) const override {
+        return graph.nodeDegree(node);
+    }
+
+    std::vector<Graphs::NodeId> getNodeIds() const override {
+        return graph.getNodeIds();
+    }
+
+    std::vector<Graphs::NodeId> getNeighborsOf(Graphs::NodeId node) const override {
+        return graph.getNeighborsOf(node);
+    }
+
+    void setEdge(const Graphs::EdgeInfo&) override {
+        throw std::logic_error("Benchmark view is read-only");
+    }
+
+    void addNodes(uint32_t) override {
+        throw std::logic_error("Benchmark view is read-only");
+    }
+
+    void removeNode(Graphs::NodeId) override {
+        throw std::logic_error("Benchmark view is read-only");
+    }
+
+    void removeEdge(const Graphs::EdgeInfo&) override {
+        throw std::logic_error("Benchmark view is read-only");
+    }
+
+    private:
+    std::string show() const override {
+        return {};
+    }
+
+    const Graphs::CsrGraph& graph;
+};
+} // namespace
+
+std::fstream Graph::Benchmark::open_file(const std::string& file_path, Mode mode) const {
     std::fstream file;
     switch (mode)
     {
@@ -18,9 +162,21 @@ void Graph::Benchmark::run(Graphs::Graph& graph,
         file.open(file_path, std::ios_base::out);
         break;
     }
+    return file;
+}
+
+void Graph::Benchmark::run(Graphs::Graph& graph,
+                           std::string identifier,
+                           std::string file_path,
+                           uint16_t iterations,
+                           Mode mode,
+                           bool bench_log,
+                           bool alg_log,
+                           std::optional<uint32_t> chromatic_number) {
+    auto file = open_file(file_path, mode);
     if (file.good())
     {
-        this->color_benchmark(graph, identifier, iterations, file, bench_log, alg_log);
+        this->color_benchmark(graph, identifier, iterations, file, bench_log, alg_log, chromatic_number);
     }
     else
     {
@@ -33,20 +189,581 @@ void Graph::Benchmark::run(Graphs::Graph& graph,
     file.close();
 }
 
+/*
+        Each iteration writes a line in the form of:
+        identifier;iteration;greedy colors;duration [us];allocations;allocated bytes
+        The allocation columns count every call of the global operator new
+        made during the run, pmr scratch space and plain containers alike.
+        When the chromatic number of the graph is known (e.g. the graph was
+        generated with a planted coloring), the line is extended with:
+        ;chromatic number;gap between greedy colors and chromatic number
+*/
 void Graph::Benchmark::color_benchmark(Graphs::Graph& graph,
                                        std::string identifier,
                                        uint16_t iterations,
                                        std::fstream& file,
                                        bool bench_log,
-                                       bool alg_log) {
+                                       bool alg_log,
+                                       std::optional<uint32_t> chromatic_number) {
+    using namespace Graphs::Algorithm;
+
+    auto result = std::make_shared<ColoringResult>();
+
     for (uint16_t i = 0; i < iterations; i++)
     {
+        auto start = std::chrono::steady_clock::now();
+        {
+            HeapCounter counter;
+            if (alg_log)
+            {
+                GreedyColoring<verbose>{result}(graph);
+            }
+            else
+            {
+                GreedyColoring<notVerbose>{result}(graph);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        auto colors = count_colors(*result);
         file << identifier << ";";
         file << i << ";";
+        file << colors << ";";
+        file << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << ";";
+        file << heap_allocations.load() << ";";
+        file << heap_bytes.load();
+        if (chromatic_number.has_value())
+        {
+            file << ";" << chromatic_number.value();
+            file << ";" << static_cast<int64_t>(colors) - static_cast<int64_t>(chromatic_number.value());
+        }
+        file << std::endl;
+
+        if (bench_log)
+        {
+            std::cout << "    Iteration " << i + 1 << " done" << std::endl;
+        }
+    }
+}
+
+void Graph::Benchmark::run_edge_coloring(Graphs::Graph& graph,
+                                         std::string identifier,
+                                         std::string file_path,
+                                         uint16_t iterations,
+                                         Mode mode,
+                                         bool bench_log) {
+    auto file = open_file(file_path, mode);
+    if (file.good())
+    {
+        this->edge_color_benchmark(graph, identifier, iterations, file, bench_log);
+    }
+    else
+    {
+        std::cout << "Error opening the benchmark file" << std::endl;
+    }
+    if (bench_log)
+    {
+        std::cout << "Edge coloring benchmark of " << identifier << " done" << std::endl;
+    }
+    file.close();
+}
+
+/*
+        Compares both edge coloring paths on the same edge index. Each
+        iteration writes a line per method in the form of:
+        identifier;iteration;method;colors;max degree;duration [us];working memory [B]
+        The duration includes building the line graph, but not the edge index.
+*/
+void Graph::Benchmark::edge_color_benchmark(Graphs::Graph& graph,
+                                            std::string identifier,
+                                            uint16_t iterations,
+                                            std::fstream& file,
+                                            bool bench_log) {
+    using namespace Graphs::Algorithm;
+
+    const Graphs::EdgeIndex index(graph);
+    const std::pair<EdgeColoring::Method, const char*> methods[] = {
+        {EdgeColoring::Method::misraGries, "misra_gries"},
+        {EdgeColoring::Method::lineGraph,  "line_graph" }
+    };
+    auto result = std::make_shared<EdgeColoringResult>();
+
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (const auto& [method, name] : methods)
+        {
+            auto start = std::chrono::steady_clock::now();
+            EdgeColoring{result, method}(index);
+            auto end = std::chrono::steady_clock::now();
+
+            file << identifier << ";";
+            file << i << ";";
+            file << name << ";";
+            file << result->colorsAmount() << ";";
+            file << index.maxDegree() << ";";
+            file << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << ";";
+            file << result->workingMemory << std::endl;
+        }
+
+        if (bench_log)
+        {
+            std::cout << "    Iteration " << i + 1 << " done" << std::endl;
+        }
+    }
+}
+
+void Graph::Benchmark::run_bfs(Graphs::Graph& graph,
+                               std::string identifier,
+                               std::string file_path,
+                               uint16_t iterations,
+                               Mode mode,
+                               bool bench_log,
+                               uint32_t threads_count) {
+    auto file = open_file(file_path, mode);
+    if (file.good())
+    {
+        this->bfs_benchmark(graph, identifier, iterations, file, bench_log, threads_count);
+    }
+    else
+    {
+        std::cout << "Error opening the benchmark file" << std::endl;
+    }
+    if (bench_log)
+    {
+        std::cout << "BFS benchmark of " << identifier << " done" << std::endl;
+    }
+    file.close();
+}
+
+/*
+        Runs the queue BFS and the direction-optimizing BFS on one thread and
+        on threads_count threads (0 means all hardware threads), always from
+        the node of the highest degree. Each iteration writes a line per
+        variant in the form of:
+        identifier;iteration;method;threads;reached nodes;depth;duration [us]
+        The graph is converted to CSR once, before the measurements.
+*/
+void Graph::Benchmark::bfs_benchmark(Graphs::Graph& graph,
+                                     std::string identifier,
+                                     uint16_t iterations,
+                                     std::fstream& file,
+                                     bool bench_log,
+                                     uint32_t threads_count) {
+    using namespace Graphs::Algorithm;
+
+    std::optional<Graphs::CsrGraph> converted;
+    const auto& csr_graph = Graphs::CsrGraph::from(graph, converted);
+    if (csr_graph.nodesAmount() == 0)
+    {
+        return;
+    }
+
+    const auto source = csr_graph.originalId(highest_degree_node(csr_graph));
+
+    const struct
+    {
+        BreadthFirstSearch::Method method;
+        const char* name;
+        uint32_t threads;
+    } variants[] = {
+        {BreadthFirstSearch::Method::queue,               "queue",                1            },
+        {BreadthFirstSearch::Method::directionOptimizing, "direction_optimizing", 1            },
+        {BreadthFirstSearch::Method::directionOptimizing, "direction_optimizing", threads_count}
+    };
+    auto result = std::make_shared<BfsResult>();
+
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (const auto& variant : variants)
+        {
+            auto start = std::chrono::steady_clock::now();
+            BreadthFirstSearch{result, source, variant.method, variant.threads}(csr_graph);
+            auto end = std::chrono::steady_clock::now();
+
+            uint32_t reached = 0;
+            uint32_t depth = 0;
+            for (auto level : result->levels)
+            {
+                if (level != BfsResult::unreached)
+                {
+                    reached++;
+                    depth = std::max(depth, level);
+                }
+            }
+
+            file << identifier << ";";
+            file << i << ";";
+            file << variant.name << ";";
+            file << Graphs::Parallel::resolveThreadsCount(variant.threads) << ";";
+            file << reached << ";";
+            file << depth << ";";
+            file << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << std::endl;
+        }
+
+        if (bench_log)
+        {
+            std::cout << "    Iteration " << i + 1 << " done" << std::endl;
+        }
+    }
+}
+
+/*
+        Runs max_flow_benchmark on every throughput matrix graph_<size>_thr.mat
+        of samples_directory (like BenchmarkSamples/SSP_test), in increasing
+        order of size, with the size as the identifier.
+*/
+void Graph::Benchmark::run_max_flow(std::string samples_directory,
+                                    std::string file_path,
+                                    uint16_t iterations,
+                                    Mode mode,
+                                    bool bench_log) {
+    auto file = open_file(file_path, mode);
+    if (not file.good())
+    {
+        std::cout << "Error opening the benchmark file" << std::endl;
+        return;
+    }
+
+    const std::string prefix = "graph_";
+    const std::string suffix = "_thr.mat";
+    std::vector<std::pair<uint32_t, std::string>> samples;
+    for (const auto& entry : std::filesystem::directory_iterator(samples_directory))
+    {
+        auto name = entry.path().filename().string();
+        if (name.size() > prefix.size() + suffix.size() and name.starts_with(prefix) and name.ends_with(suffix))
+        {
+            auto size = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+            samples.emplace_back(static_cast<uint32_t>(std::stoul(size)), entry.path().string());
+        }
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (const auto& [size, path] : samples)
+    {
+        Graphs::AdjMatrix graph(path);
+        this->max_flow_benchmark(graph, std::to_string(size), iterations, file, bench_log);
+        if (bench_log)
+        {
+            std::cout << "Max flow benchmark of " << path << " done" << std::endl;
+        }
+    }
+    file.close();
+}
+
+/*
+        Computes the maximum flow from the lowest to the highest node id, with
+        the edge weights as capacities, by push-relabel and by Dinic. Each
+        iteration writes a line per method in the form of:
+        identifier;iteration;method;nodes;edges;flow value;duration [us]
+        The graph is converted to CSR once, before the measurements.
+*/
+void Graph::Benchmark::max_flow_benchmark(Graphs::Graph& graph,
+                                          std::string identifier,
+                                          uint16_t iterations,
+                                          std::fstream& file,
+                                          bool bench_log) {
+    using namespace Graphs::Algorithm;
+
+    std::optional<Graphs::CsrGraph> converted;
+    const auto& csr_graph = Graphs::CsrGraph::from(graph, converted);
+    if (csr_graph.nodesAmount() < 2)
+    {
+        return;
+    }
+    const auto source = csr_graph.originalId(0);
+    const auto sink = csr_graph.originalId(csr_graph.nodesAmount() - 1);
+
+    const struct
+    {
+        MaxFlow::Method method;
+        const char* name;
+    } variants[] = {
+        {MaxFlow::Method::pushRelabel, "push_relabel"},
+        {MaxFlow::Method::dinic,       "dinic"       }
+    };
+    auto result = std::make_shared<FlowResult>();
+
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (const auto& variant : variants)
+        {
+            auto start = std::chrono::steady_clock::now();
+            MaxFlow{result, source, sink, variant.method}(csr_graph);
+            auto end = std::chrono::steady_clock::now();
+
+            file << identifier << ";";
+            file << i << ";";
+            file << variant.name << ";";
+            file << csr_graph.nodesAmount() << ";";
+            file << csr_graph.edgesAmount() << ";";
+            file << result->value << ";";
+            file << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << std::endl;
+        }
+
+        if (bench_log)
+        {
+            std::cout << "    Iteration " << i + 1 << " done" << std::endl;
+        }
+    }
+}
+
+void Graph::Benchmark::run_reordering(Graphs::Graph& graph,
+                                      std::string identifier,
+                                      std::string file_path,
+                                      uint16_t iterations,
+                                      Mode mode,
+                                      bool bench_log) {
+    auto file = open_file(file_path, mode);
+    if (file.good())
+    {
+        this->reordering_benchmark(graph, identifier, iterations, file, bench_log);
+    }
+    else
+    {
+        std::cout << "Error opening the benchmark file" << std::endl;
+    }
+    if (bench_log)
+    {
+        std::cout << "Reordering benchmark of " << identifier << " done" << std::endl;
+    }
+    file.close();
+}
+
+/*
+        Relabels the graph with every ordering and times the queue BFS from
+        the node of the highest degree and the greedy coloring on the result,
+        against the same runs on the graph in its own order. Each iteration
+        writes a line per ordering (the first one being "original") in the
+        form of:
+        identifier;iteration;ordering;reordering [us];bfs [us];coloring [us];bfs speedup;coloring speedup
+*/
+void Graph::Benchmark::reordering_benchmark(Graphs::Graph& graph,
+                                            std::string identifier,
+                                            uint16_t iterations,
+                                            std::fstream& file,
+                                            bool bench_log) {
+    using namespace Graphs::Algorithm;
+    using Clock = std::chrono::steady_clock;
+
+    std::optional<Graphs::CsrGraph> converted;
+    const auto& csr_graph = Graphs::CsrGraph::from(graph, converted);
+    if (csr_graph.nodesAmount() == 0)
+    {
+        return;
+    }
+
+    const auto hub = highest_degree_node(csr_graph);
+
+    const struct
+    {
+        std::optional<Graphs::Ordering> ordering;
+        const char* name;
+    } variants[] = {
+        {std::nullopt,                          "original"},
+        {Graphs::Ordering::degree,              "degree"  },
+        {Graphs::Ordering::reverseCuthillMcKee, "rcm"     },
+        {Graphs::Ordering::gorder,              "gorder"  }
+    };
+    auto bfs_result = std::make_shared<BfsResult>();
+    auto coloring_result = std::make_shared<ColoringResult>();
+
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        double original_bfs = 0;
+        double original_coloring = 0;
+        for (const auto& variant : variants)
+        {
+            auto start = Clock::now();
+            std::optional<Graphs::Relabeling> relabeling;
+            if (variant.ordering.has_value())
+            {
+                relabeling.emplace(Graphs::reorder(csr_graph, variant.ordering.value()));
+            }
+            const auto& ordered = relabeling ? relabeling->graph : csr_graph;
+            const auto source = relabeling ? relabeling->permutation[csr_graph.originalId(hub)] : csr_graph.originalId(hub);
+
+            auto bfs_start = Clock::now();
+            BreadthFirstSearch{bfs_result, source}(ordered);
+            auto coloring_start = Clock::now();
+            GreedyColoring<notVerbose>{coloring_result}(ordered);
+            auto end = Clock::now();
+
+            const auto reordering = std::chrono::duration_cast<std::chrono::microseconds>(bfs_start - start).count();
+            const auto bfs = std::chrono::duration<double, std::micro>(coloring_start - bfs_start).count();
+            const auto coloring = std::chrono::duration<double, std::micro>(end - coloring_start).count();
+            if (not variant.ordering.has_value())
+            {
+                original_bfs = bfs;
+                original_coloring = coloring;
+            }
+
+            file << identifier << ";";
+            file << i << ";";
+            file << variant.name << ";";
+            file << reordering << ";";
+            file << static_cast<int64_t>(bfs) << ";";
+            file << static_cast<int64_t>(coloring) << ";";
+            file << original_bfs / bfs << ";";
+            file << original_coloring / coloring << std::endl;
+        }
+
+        if (bench_log)
+        {
+            std::cout << "    Iteration " << i + 1 << " done" << std::endl;
+        }
+    }
+}
+
+void Graph::Benchmark::run_placement(std::string graph_path,
+                                     std::string identifier,
+                                     std::string file_path,
+                                     uint16_t iterations,
+                                     Mode mode,
+                                     bool bench_log,
+                                     uint32_t threads_count) {
+    auto file = open_file(file_path, mode);
+    if (file.good())
+    {
+        this->placement_benchmark(graph_path, identifier, iterations, file, bench_log, threads_count);
+    }
+    else
+    {
+        std::cout << "Error opening the benchmark file" << std::endl;
+    }
+    if (bench_log)
+    {
+        std::cout << "Placement benchmark of " << identifier << " done" << std::endl;
+    }
+    file.close();
+}
+
+/*
+        Loads the graph file into CSR arrays placed by every memory placement
+        and runs the direction-optimizing BFS on threads_count threads (0 means
+        all hardware threads) from the node of the highest degree. Each
+        iteration writes a line per placement in the form of:
+        identifier;iteration;pages;numa;threads;load [us];bfs [us]
+        Pages and numa name the placement actually achieved, e.g. hugetlb
+        falls back to transparent_huge without reserved huge pages and numa
+        policies read none on a single memory node.
+*/
+void Graph::Benchmark::placement_benchmark(std::string graph_path,
+                                           std::string identifier,
+                                           uint16_t iterations,
+                                           std::fstream& file,
+                                           bool bench_log,
+                                           uint32_t threads_count) {
+    using namespace Graphs::Algorithm;
+    using namespace Graphs::Memory;
+
+    const Placement placements[] = {
+        {PageSize::standard,        NumaPolicy::none,       threads_count},
+        {PageSize::transparentHuge, NumaPolicy::none,       threads_count},
+        {PageSize::hugeTlb,         NumaPolicy::none,       threads_count},
+        {PageSize::transparentHuge, NumaPolicy::interleave, threads_count},
+        {PageSize::transparentHuge, NumaPolicy::firstTouch, threads_count}
+    };
+    auto result = std::make_shared<BfsResult>();
+
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (const auto& placement : placements)
+        {
+            PlacementResource resource(placement);
+
+            auto load_start = std::chrono::steady_clock::now();
+            Graphs::CsrGraph graph(graph_path, &resource);
+            auto load_end = std::chrono::steady_clock::now();
+            if (graph.nodesAmount() == 0)
+            {
+                return;
+            }
+
+            auto source = graph.originalId(highest_degree_node(graph));
+            auto start = std::chrono::steady_clock::now();
+            BreadthFirstSearch{result, source, BreadthFirstSearch::Method::directionOptimizing, threads_count}(graph);
+            auto end = std::chrono::steady_clock::now();
+
+            auto achieved = resource.effective();
+            file << identifier << ";";
+            file << i << ";";
+            file << toString(achieved.pages) << ";";
+            file << toString(achieved.numa) << ";";
+            file << Graphs::Parallel::resolveThreadsCount(threads_count) << ";";
+            file << std::chrono::duration_cast<std::chrono::microseconds>(load_end - load_start).count() << ";";
+            file << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << std::endl;
+        }
+
+        if (bench_log)
+        {
+            std::cout << "    Iteration " << i + 1 << " done" << std::endl;
+        }
+    }
+}
+
+void Graph::Benchmark::run_dispatch(Graphs::Graph& graph,
+                                    std::string identifier,
+                                    std::string file_path,
+                                    uint16_t iterations,
+                                    Mode mode,
+                                    bool bench_log) {
+    auto file = open_file(file_path, mode);
+    if (file.good())
+    {
+        this->dispatch_benchmark(graph, identifier, iterations, file, bench_log);
+    }
+    else
+    {
+        std::cout << "Error opening the benchmark file" << std::endl;
+    }
+    if (bench_log)
+    {
+        std::cout << "Dispatch benchmark of " << identifier << " done" << std::endl;
+    }
+    file.close();
+}
+
+/*
+        Greedy coloring of the same CSR arrays through the virtual graph
+        interface and through the static template path. Each iteration
+        writes a line per path in the form of:
+        identifier;iteration;dispatch;greedy colors;duration [us]
+        The graph is converted to CSR once, before the measurements.
+*/
+void Graph::Benchmark::dispatch_benchmark(Graphs::Graph& graph,
+                                          std::string identifier,
+                                          uint16_t iterations,
+                                          std::fstream& file,
+                                          bool bench_log) {
+    using namespace Graphs::Algorithm;
+
+    std::optional<Graphs::CsrGraph> converted;
+    const auto& csr_graph = Graphs::CsrGraph::from(graph, converted);
+    const InterfaceOnly interface_only(csr_graph);
+    auto result = std::make_shared<ColoringResult>();
+
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (bool is_static : {false, true})
+        {
+            auto start = std::chrono::steady_clock::now();
+            if (is_static)
+            {
+                GreedyColoring<notVerbose>{result}(csr_graph);
+            }
+            else
+            {
+                GreedyColoring<notVerbose>{result}(interface_only);
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            file << identifier << ";";
+            file << i << ";";
+            file << (is_static ? "static" : "virtual") << ";";
+            file << count_colors(*result) << ";";
+            file << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << std::endl;
+        }
 
-        // file << graph.greedy_coloring(alg_log) << ";";
-        // file << graph.lf_coloring(alg_log) << ";";
-        // file << graph.sl_coloring(alg_log) << std::endl;
         if (bench_log)
         {
             std::cout << "    Iteration " << i + 1 << " done" << std::endl;
@@ -0,0 +1,303 @@
+// this
+#include <Graphs/BreadthFirstSearch.hpp>
+
+// libraries
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <Graphs/CompressedGraph.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Parallel.hpp>
+#include <numeric>
+#include <optional>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+struct Traversal
+{
+    std::vector<uint32_t> levels;
+    std::vector<NodeId> parents;
+};
+
+template <class GraphType>
+Traversal queueTraversal(const GraphType& graph, NodeId root) {
+    const auto nodesCount = graph.nodesAmount();
+    Traversal traversal{std::vector<uint32_t>(nodesCount, BfsResult::unreached),
+                        std::vector<NodeId>(nodesCount, BfsResult::noParent)};
+
+    std::vector<NodeId> queue;
+    queue.reserve(nodesCount);
+    queue.push_back(root);
+    traversal.levels[root] = 0;
+    traversal.parents[root] = root;
+
+    for (std::size_t head = 0; head < queue.size(); head++)
+    {
+        auto node = queue[head];
+        graph.forEachNeighbor(node, [&traversal, &queue, node](NodeId neighbor) {
+            if (traversal.levels[neighbor] == BfsResult::unreached)
+            {
+                traversal.levels[neighbor] = traversal.levels[node] + 1;
+                traversal.parents[neighbor] = node;
+                queue.push_back(neighbor);
+            }
+        });
+    }
+    return traversal;
+}
+
+/* Bottom-up steps need incoming edges, which the graph itself provides only when it is symmetric */
+bool isSymmetric(const CsrGraph& graph, uint32_t threadsCount) {
+    auto hint = graph.metadata().find(symmetricKey);
+    if (hint != graph.metadata().end() and hint->second == "true")
+    {
+        return true;
+    }
+
+    std::atomic<bool> symmetric = true;
+    Parallel::forEachChunk(0, graph.nodesAmount(), threadsCount, [&graph, &symmetric](uint64_t begin, uint64_t end, uint32_t) {
+        for (auto node = static_cast<NodeId>(begin); node < end and symmetric.load(std::memory_order_relaxed); node++)
+        {
+            for (auto neighbor : graph.neighbors(node))
+            {
+                if (not std::ranges::binary_search(graph.neighbors(neighbor), node))
+                {
+                    symmetric.store(false, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+    });
+    return symmetric.load();
+}
+
+CsrGraph transpose(const CsrGraph& graph) {
+    const auto nodesCount = graph.nodesAmount();
+    std::pmr::vector<CsrGraph::Offset> offsets(static_cast<std::size_t>(nodesCount) + 1, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        for (auto neighbor : graph.neighbors(node))
+        {
+            offsets[neighbor + 1]++;
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // sources are visited in increasing order, so every row comes out sorted
+    std::pmr::vector<NodeId> adjacency(offsets.back());
+    std::vector<CsrGraph::Offset> cursors(offsets.begin(), offsets.end() - 1);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        for (auto neighbor : graph.neighbors(node))
+        {
+            adjacency[cursors[neighbor]++] = node;
+        }
+    }
+    return CsrGraph(std::move(offsets), std::move(adjacency));
+}
+
+/*
+        Visited nodes are claimed through their parent entry. In top-down steps
+        many frontier nodes may race for the same neighbor and a CAS decides,
+        in bottom-up steps every thread owns whole 64-node words of the next
+        frontier bitmap, so no write is shared.
+*/
+Traversal directionOptimizingTraversal(const CsrGraph& graph, const CsrGraph& incoming, NodeId root, uint32_t threadsCount) {
+    constexpr NodeId unset = BfsResult::noParent;
+    const auto nodesCount = graph.nodesAmount();
+    const auto wordsCount = (static_cast<std::size_t>(nodesCount) + 63) / 64;
+    const auto threads = Parallel::resolveThreadsCount(threadsCount);
+
+    std::vector<uint32_t> levels(nodesCount, BfsResult::unreached);
+    std::vector<std::atomic<NodeId>> parents(nodesCount);
+    Parallel::forEachChunk(0, nodesCount, threads, [&parents](uint64_t begin, uint64_t end, uint32_t) {
+        for (auto node = begin; node < end; node++)
+        {
+            parents[node].store(unset, std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<NodeId> frontier = {root};
+    std::vector<uint64_t> frontierBits(wordsCount, 0);
+    std::vector<uint64_t> nextBits(wordsCount, 0);
+    std::vector<std::vector<NodeId>> localFrontiers(threads);
+    std::vector<uint64_t> localSizes(threads);
+    std::vector<uint64_t> localEdges(threads);
+
+    levels[root] = 0;
+    parents[root].store(root, std::memory_order_relaxed);
+
+    uint64_t frontierSize = 1;
+    uint64_t frontierEdges = graph.nodeDegree(root);
+    uint64_t unexploredEdges = graph.edgesAmount() - frontierEdges;
+    bool bottomUp = false;
+
+    for (uint32_t level = 1; frontierSize > 0; level++)
+    {
+        auto previousSize = frontierSize;
+        std::ranges::fill(localSizes, 0);
+        std::ranges::fill(localEdges, 0);
+
+        if (not bottomUp and frontierEdges > unexploredEdges / BreadthFirstSearch::alpha)
+        {
+            bottomUp = true;
+            std::ranges::fill(frontierBits, 0);
+            for (auto node : frontier)
+            {
+                frontierBits[node / 64] |= uint64_t{1} << (node % 64);
+            }
+        }
+
+        if (bottomUp)
+        {
+            Parallel::forEachChunk(0, wordsCount, threads, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+                for (auto word = begin; word < end; word++)
+                {
+                    uint64_t bits = 0;
+                    const auto last = std::min<uint64_t>(nodesCount, (word + 1) * 64);
+                    for (auto node = static_cast<NodeId>(word * 64); node < last; node++)
+                    {
+                        if (parents[node].load(std::memory_order_relaxed) != unset)
+                        {
+                            continue;
+                        }
+                        for (auto parent : incoming.neighbors(node))
+                        {
+                            if (frontierBits[parent / 64] & (uint64_t{1} << (parent % 64)))
+                            {
+                                parents[node].store(parent, std::memory_order_relaxed);
+                                levels[node] = level;
+                                bits |= uint64_t{1} << (node % 64);
+                                localSizes[thread]++;
+                                localEdges[thread] += graph.nodeDegree(node);
+                                break;
+                            }
+                        }
+                    }
+                    nextBits[word] = bits;
+                }
+            });
+            std::swap(frontierBits, nextBits);
+        }
+        else
+        {
+            Parallel::forEachChunk(0, frontier.size(), threads, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+                auto& next = localFrontiers[thread];
+                for (auto i = begin; i < end; i++)
+                {
+                    auto node = frontier[i];
+                    for (auto neighbor : graph.neighbors(node))
+                    {
+                        auto expected = unset;
+                        if (parents[neighbor].load(std::memory_order_relaxed) == unset
+                            and parents[neighbor].compare_exchange_strong(expected, node, std::memory_order_relaxed))
+                        {
+                            levels[neighbor] = level;
+                            next.push_back(neighbor);
+                            localEdges[thread] += graph.nodeDegree(neighbor);
+                        }
+                    }
+                }
+                localSizes[thread] = next.size();
+            });
+
+            frontier.clear();
+            for (auto& next : localFrontiers)
+            {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+                next.clear();
+            }
+        }
+
+        frontierSize = std::accumulate(localSizes.begin(), localSizes.end(), uint64_t{0});
+        frontierEdges = std::accumulate(localEdges.begin(), localEdges.end(), uint64_t{0});
+        unexploredEdges -= frontierEdges;
+
+        if (bottomUp and frontierSize < previousSize and frontierSize < nodesCount / BreadthFirstSearch::beta)
+        {
+            bottomUp = false;
+            frontier.clear();
+            for (std::size_t word = 0; word < wordsCount; word++)
+            {
+                for (auto bits = frontierBits[word]; bits != 0; bits &= bits - 1)
+                {
+                    frontier.push_back(static_cast<NodeId>(word * 64 + std::countr_zero(bits)));
+                }
+            }
+        }
+    }
+
+    Traversal traversal{std::move(levels), std::vector<NodeId>(nodesCount)};
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        traversal.parents[node] = parents[node].load(std::memory_order_relaxed);
+    }
+    return traversal;
+}
+
+template <class GraphType>
+NodeId findRoot(const GraphType& graph, NodeId source) {
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        if (graph.originalId(node) == source)
+        {
+            return node;
+        }
+    }
+    throw std::out_of_range("BFS source is not a node of the graph");
+}
+
+template <class GraphType>
+void storeTraversal(BfsResult& result, const GraphType& graph, const Traversal& traversal) {
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        maxNodeId = std::max(maxNodeId, graph.originalId(node));
+    }
+
+    result.levels.assign(static_cast<std::size_t>(maxNodeId) + 1, BfsResult::unreached);
+    result.parents.assign(static_cast<std::size_t>(maxNodeId) + 1, BfsResult::noParent);
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        auto originalId = graph.originalId(node);
+        result.levels[originalId] = traversal.levels[node];
+        if (traversal.parents[node] != BfsResult::noParent)
+        {
+            result.parents[originalId] = graph.originalId(traversal.parents[node]);
+        }
+    }
+}
+} // namespace
+
+void BreadthFirstSearch::operator()(const Graphs::Graph& graph) {
+    // compressed graphs are traversed in place by the queue method, anything else runs on CSR
+    if (auto compressedGraph = dynamic_cast<const CompressedGraph*>(&graph); compressedGraph and method == Method::queue)
+    {
+        auto root = findRoot(*compressedGraph, source);
+        storeTraversal(*result, *compressedGraph, queueTraversal(*compressedGraph, root));
+        return;
+    }
+
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    auto root = findRoot(csrGraph, source);
+
+    Traversal traversal;
+    if (method == Method::directionOptimizing)
+    {
+        std::optional<CsrGraph> transposed;
+        if (not isSymmetric(csrGraph, threadsCount))
+        {
+            transposed.emplace(transpose(csrGraph));
+        }
+        traversal = directionOptimizingTraversal(csrGraph, transposed ? *transposed : csrGraph, root, threadsCount);
+    }
+    else
+    {
+        traversal = queueTraversal(csrGraph, root);
+    }
+    storeTraversal(*result, csrGraph, traversal);
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,232 @@
+// this
+#include <Graphs/Centrality.hpp>
+
+// libraries
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Parallel.hpp>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+constexpr uint64_t infinite = std::numeric_limits<uint64_t>::max();
+
+/* Buffers of one thread, reset only where the previous traversal reached */
+struct Workspace
+{
+    explicit Workspace(uint32_t nodesCount)
+        : distances(nodesCount, infinite), paths(nodesCount, 0), dependencies(nodesCount, 0), settled(nodesCount, 0),
+          betweenness(nodesCount, 0), closeness(nodesCount, 0) {}
+
+    std::vector<uint64_t> distances;
+    std::vector<double> paths;
+    std::vector<double> dependencies;
+    std::vector<uint8_t> settled;
+    std::vector<NodeId> order;
+
+    std::vector<double> betweenness;
+    std::vector<double> closeness;
+};
+
+using HeapEntry = std::pair<uint64_t, NodeId>;
+
+void breadthFirstOrder(const CsrGraph& graph, Workspace& workspace) {
+    auto& distances = workspace.distances;
+    auto& paths = workspace.paths;
+    for (std::size_t head = 0; head < workspace.order.size(); head++)
+    {
+        auto node = workspace.order[head];
+        for (auto neighbor : graph.neighbors(node))
+        {
+            if (distances[neighbor] == infinite)
+            {
+                distances[neighbor] = distances[node] + 1;
+                workspace.order.push_back(neighbor);
+            }
+            if (distances[neighbor] == distances[node] + 1)
+            {
+                paths[neighbor] += paths[node];
+            }
+        }
+    }
+}
+
+void dijkstraOrder(const CsrGraph& graph, NodeId source, Workspace& workspace) {
+    auto& distances = workspace.distances;
+    auto& paths = workspace.paths;
+    workspace.order.clear();
+
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>> heap;
+    heap.emplace(0, source);
+    while (not heap.empty())
+    {
+        auto [distance, node] = heap.top();
+        heap.pop();
+        if (workspace.settled[node] or distance != distances[node])
+        {
+            continue;
+        }
+        workspace.settled[node] = 1;
+        workspace.order.push_back(node);
+
+        // positive weights settle every shortest-path predecessor before its successors
+        auto neighbors = graph.neighbors(node);
+        auto weights = graph.weights(node);
+        for (std::size_t i = 0; i < neighbors.size(); i++)
+        {
+            auto neighbor = neighbors[i];
+            auto candidate = distance + weights[i];
+            if (candidate < distances[neighbor])
+            {
+                distances[neighbor] = candidate;
+                paths[neighbor] = paths[node];
+                heap.emplace(candidate, neighbor);
+            }
+            else if (candidate == distances[neighbor])
+            {
+                paths[neighbor] += paths[node];
+            }
+        }
+    }
+}
+
+void accumulateSource(const CsrGraph& graph, NodeId source, double betweennessScale, double closenessScale, Workspace& workspace) {
+    for (auto node : workspace.order)
+    {
+        workspace.distances[node] = infinite;
+        workspace.paths[node] = 0;
+        workspace.dependencies[node] = 0;
+        workspace.settled[node] = 0;
+    }
+    workspace.order.assign(1, source);
+    workspace.distances[source] = 0;
+    workspace.paths[source] = 1;
+
+    if (graph.isWeighted())
+    {
+        dijkstraOrder(graph, source, workspace);
+    }
+    else
+    {
+        breadthFirstOrder(graph, workspace);
+    }
+
+    const auto& distances = workspace.distances;
+    const auto& paths = workspace.paths;
+    auto& dependencies = workspace.dependencies;
+    for (auto i = workspace.order.size(); i-- > 0;)
+    {
+        auto node = workspace.order[i];
+        auto neighbors = graph.neighbors(node);
+        auto weights = graph.weights(node);
+
+        double dependency = 0;
+        for (std::size_t j = 0; j < neighbors.size(); j++)
+        {
+            auto neighbor = neighbors[j];
+            auto length = weights.empty() ? 1 : weights[j];
+            if (distances[neighbor] == distances[node] + length)
+            {
+                dependency += paths[node] / paths[neighbor] * (1 + dependencies[neighbor]);
+            }
+        }
+        dependencies[node] = dependency;
+
+        if (node != source)
+        {
+            workspace.betweenness[node] += dependency * betweennessScale;
+            workspace.closeness[node] += closenessScale / static_cast<double>(distances[node]);
+        }
+    }
+}
+} // namespace
+
+uint32_t Centrality::samplesAmount(uint32_t nodesCount, const CentralitySampling& parameters) {
+    auto amount = std::ceil(std::log(2.0 * std::max(1u, nodesCount) / parameters.delta) / (2 * parameters.epsilon * parameters.epsilon));
+    return static_cast<uint32_t>(std::min<double>(amount, std::numeric_limits<uint32_t>::max()));
+}
+
+void Centrality::operator()(const Graphs::Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+
+    if (csrGraph.isWeighted())
+    {
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            if (std::ranges::find(csrGraph.weights(node), 0u) != csrGraph.weights(node).end())
+            {
+                throw std::invalid_argument("Centrality requires positive edge weights");
+            }
+        }
+    }
+
+    std::vector<NodeId> sources;
+    double betweennessScale = 1;
+    double closenessScale = nodesCount > 1 ? 1.0 / (nodesCount - 1) : 0;
+    result->betweennessError = 0;
+    result->closenessError = 0;
+
+    auto samples = sampling.has_value() ? samplesAmount(nodesCount, *sampling) : nodesCount;
+    if (samples < nodesCount)
+    {
+        std::mt19937_64 engine(sampling->seed);
+        std::uniform_int_distribution<NodeId> uniform(0, nodesCount - 1);
+        sources.resize(samples);
+        for (auto& source : sources)
+        {
+            source = uniform(engine);
+        }
+
+        const auto scale = static_cast<double>(nodesCount) / samples;
+        betweennessScale = scale;
+        closenessScale *= scale;
+        result->betweennessError = sampling->epsilon * nodesCount * (nodesCount > 2 ? nodesCount - 2 : 0);
+        result->closenessError = sampling->epsilon * nodesCount / std::max(1u, nodesCount - 1);
+    }
+    else
+    {
+        sources.resize(nodesCount);
+        std::iota(sources.begin(), sources.end(), 0u);
+    }
+
+    std::vector<std::optional<Workspace>> workspaces(Parallel::resolveThreadsCount(threadsCount));
+    Parallel::forEachChunk(0, sources.size(), threadsCount, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+        auto& workspace = workspaces[thread].emplace(nodesCount);
+        for (auto i = begin; i < end; i++)
+        {
+            accumulateSource(csrGraph, sources[i], betweennessScale, closenessScale, workspace);
+        }
+    });
+
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        maxNodeId = std::max(maxNodeId, csrGraph.originalId(node));
+    }
+    result->betweenness.assign(nodesCount == 0 ? 0 : static_cast<std::size_t>(maxNodeId) + 1, 0);
+    result->closeness.assign(result->betweenness.size(), 0);
+    result->sourcesAmount = static_cast<uint32_t>(sources.size());
+
+    for (const auto& workspace : workspaces)
+    {
+        if (not workspace.has_value())
+        {
+            continue;
+        }
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            result->betweenness[csrGraph.originalId(node)] += workspace->betweenness[node];
+            result->closeness[csrGraph.originalId(node)] += workspace->closeness[node];
+        }
+    }
+}
+} // namespace Graphs::Algorithm
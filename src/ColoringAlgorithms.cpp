@@ -1,9 +1,14 @@
 #include <format>
 #include <Graphs/Algorithm.hpp>
 #include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/CompressedGraph.hpp>
+#include <Graphs/CoreDecomposition.hpp>
+#include <Graphs/CsrGraph.hpp>
 #include <memory>
+#include <memory_resource>
 #include <random>
 #include <ranges>
+#include <unordered_map>
 
 namespace Graphs::Algorithm
 {
@@ -15,30 +20,54 @@ Permutation prepareNodePermutationForGreedyColoring(const Graph& graph) {
     return nodeIds;
 }
 
-ColorId
-findAvailableColorForCurrentNode(const Graph& graph, ColoringResult& coloring, ColoringResult::iterator currentNode) {
-    auto isNeighbor = [&graph, &currentNode](auto neighbor) {
-        static auto neighbors = graph.getNeighborsOf(currentNode->first);
+using NodePositions = std::pmr::unordered_map<NodeId, std::size_t>;
 
-        return std::ranges::find(neighbors, neighbor.first) != neighbors.end();
-    };
+/* Hash node plus bucket pointer of one positions entry, used to size the scratch arena up front */
+constexpr std::size_t positionEntryBytes = sizeof(NodePositions::value_type) + 3 * sizeof(void*);
 
-    auto neighborsColoringView
-        = std::ranges::subrange(coloring.begin(), coloring.end()) | std::views::filter(isNeighbor);
-    std::size_t neighborsCount = std::ranges::distance(neighborsColoringView);
-
-    auto colorFilter = [](const auto& coloring) {
-        return coloring.second;
-    };
+NodePositions mapNodesToPositions(const ColoringResult& coloring, std::pmr::memory_resource* arena) {
+    NodePositions positions(arena);
+    positions.reserve(coloring.size());
+    for (std::size_t i = 0; i < coloring.size(); i++)
+    {
+        positions.emplace(coloring[i].first, i);
+    }
+    return positions;
+}
 
-    for (const auto& color : std::views::iota(0u, neighborsCount))
+/*
+        Marks the colors of already colored neighbors with the position of the
+        current node, so that the marking table never has to be cleared and
+        each node is processed in time proportional to its degree.
+*/
+ColorId findAvailableColorForCurrentNode(const Graph& graph,
+                                         const ColoringResult& coloring,
+                                         const NodePositions& positions,
+                                         std::pmr::vector<std::size_t>& usedColorMarks,
+                                         std::size_t currentPosition) {
+    const auto mark = currentPosition + 1;
+    for (const auto& neighbor : graph.getNeighborsOf(coloring[currentPosition].first))
     {
-        if (std::ranges::find(neighborsColoringView, color, colorFilter) == neighborsColoringView.end())
+        auto neighborPosition = positions.find(neighbor);
+        if (neighborPosition == positions.end() or neighborPosition->second >= currentPosition)
         {
-            return color;
+            continue;
         }
+
+        auto neighborColor = coloring[neighborPosition->second].second;
+        if (neighborColor >= usedColorMarks.size())
+        {
+            usedColorMarks.resize(neighborColor + 1, 0);
+        }
+        usedColorMarks[neighborColor] = mark;
     }
-    return neighborsCount + 1;
+
+    ColorId color = 0;
+    while (color < usedColorMarks.size() and usedColorMarks[color] == mark)
+    {
+        color++;
+    }
+    return color;
 }
 
 ColoringResult resizeAndInitializeResultStructure(const Permutation& nodes) {
@@ -53,6 +82,42 @@ ColoringResult resizeAndInitializeResultStructure(const Permutation& nodes) {
 }
 } // namespace
 
+Permutation largestFirstOrder(const Graphs::Graph& graph) {
+    auto nodeIds = graph.getNodeIds();
+
+    std::vector<uint32_t> nodeDegrees(nodeIds.size());
+    uint32_t maxDegree = 0;
+    for (std::size_t i = 0; i < nodeIds.size(); i++)
+    {
+        nodeDegrees[i] = graph.nodeDegree(nodeIds[i]);
+        maxDegree = std::max(maxDegree, nodeDegrees[i]);
+    }
+
+    // bucket starts are counted from the highest degree down
+    std::vector<std::size_t> bucketStarts(static_cast<std::size_t>(maxDegree) + 2, 0);
+    for (auto degree : nodeDegrees)
+    {
+        bucketStarts[maxDegree - degree + 1]++;
+    }
+    for (std::size_t i = 1; i < bucketStarts.size(); i++)
+    {
+        bucketStarts[i] += bucketStarts[i - 1];
+    }
+
+    Permutation order(nodeIds.size());
+    for (std::size_t i = 0; i < nodeIds.size(); i++)
+    {
+        order[bucketStarts[maxDegree - nodeDegrees[i]]++] = nodeIds[i];
+    }
+    return order;
+}
+
+Permutation smallestLastOrder(const Graphs::Graph& graph) {
+    auto cores = std::make_shared<CoreResult>();
+    CoreDecomposition{cores}(graph);
+    return {cores->removalOrder.rbegin(), cores->removalOrder.rend()};
+}
+
 template <>
 template <class... Args, class T, Verbose<verbose, T>>
 void GreedyColoring<verbose>::log(std::string formatString, Args... args) const {
@@ -89,16 +154,16 @@ void GreedyColoring<verbose>::operator()(const Graphs::Graph& graph) {
     log("\n");
 
     *result = resizeAndInitializeResultStructure(nodes);
-    result->front().second = 0;
+    // all scratch tables die with the call, so they come from one arena over the default resource
+    std::pmr::monotonic_buffer_resource arena(result->size() * positionEntryBytes + 1024);
+    auto positions = mapNodesToPositions(*result, &arena);
+    std::pmr::vector<std::size_t> usedColorMarks(&arena);
 
-    log("Coloring node {} with color {}\n", result->front().first, result->front().second);
-
-    for (auto currentNode = ++result->begin(); currentNode != result->end(); currentNode++)
+    for (std::size_t i = 0; i < result->size(); i++)
     {
-        auto color = findAvailableColorForCurrentNode(graph, *result, currentNode);
-
-        currentNode->second = color;
-        log("Coloring node {} with color {}\n", currentNode->first, currentNode->second);
+        auto& currentNode = (*result)[i];
+        currentNode.second = findAvailableColorForCurrentNode(graph, *result, positions, usedColorMarks, i);
+        log("Coloring node {} with color {}\n", currentNode.first, currentNode.second);
     }
 
     log("Greedy coloring completed\n");
@@ -106,15 +171,26 @@ void GreedyColoring<verbose>::operator()(const Graphs::Graph& graph) {
 
 template <>
 void GreedyColoring<notVerbose>::operator()(const Graphs::Graph& graph) {
+    if (auto csrGraph = dynamic_cast<const CsrGraph*>(&graph))
+    {
+        (*this)(*csrGraph);
+        return;
+    }
+    if (auto compressedGraph = dynamic_cast<const CompressedGraph*>(&graph))
+    {
+        (*this)(*compressedGraph);
+        return;
+    }
+
     auto nodes = prepareNodePermutationForGreedyColoring(graph);
     *result = resizeAndInitializeResultStructure(nodes);
-    result->front().second = 0;
+    std::pmr::monotonic_buffer_resource arena(result->size() * positionEntryBytes + 1024);
+    auto positions = mapNodesToPositions(*result, &arena);
+    std::pmr::vector<std::size_t> usedColorMarks(&arena);
 
-    for (auto currentNode = ++result->begin(); currentNode != result->end(); currentNode++)
+    for (std::size_t i = 0; i < result->size(); i++)
     {
-        auto color = findAvailableColorForCurrentNode(graph, *result, currentNode);
-
-        currentNode->second = color;
+        (*result)[i].second = findAvailableColorForCurrentNode(graph, *result, positions, usedColorMarks, i);
     }
 }
 } // namespace Graphs::Algorithm
@@ -0,0 +1,253 @@
+// this
+#include <Graphs/CompressedGraph.hpp>
+
+// libraries
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+namespace Graphs
+{
+namespace StreamVByte
+{
+void encode(std::span<const uint32_t> values, std::vector<uint8_t>& out) {
+    auto controls = out.size();
+    out.resize(out.size() + controlBytes(static_cast<uint32_t>(values.size())), 0);
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        const auto length = std::max(1, static_cast<int>(std::bit_width(values[i]) + 7) / 8);
+        out[controls + i / 4] |= static_cast<uint8_t>((length - 1) << (2 * (i % 4)));
+        for (int byte = 0; byte < length; byte++)
+        {
+            out.push_back(static_cast<uint8_t>(values[i] >> (8 * byte)));
+        }
+    }
+}
+} // namespace StreamVByte
+
+namespace
+{
+void writeVarint(uint32_t value, std::vector<uint8_t>& out) {
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t zigzag(uint32_t difference) {
+    return (difference << 1) ^ (0u - (difference >> 31));
+}
+} // namespace
+
+CompressedGraph::CompressedGraph(const Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    nodesCount = csrGraph.nodesAmount();
+
+    weighted = csrGraph.isWeighted();
+    arcs = csrGraph.edgesAmount();
+    meta = csrGraph.metadata();
+    blockOffsets.reserve((static_cast<std::size_t>(nodesCount) >> blockShift) + 1);
+
+    std::vector<uint32_t> values;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        if ((node & ((1u << blockShift) - 1)) == 0)
+        {
+            blockOffsets.push_back(bytes.size());
+        }
+
+        auto neighbors = csrGraph.neighbors(node);
+        writeVarint(static_cast<uint32_t>(neighbors.size()), bytes);
+
+        values.clear();
+        for (std::size_t i = 0; i < neighbors.size(); i++)
+        {
+            // differences wrap around 2^32, the decoder adds them back with the same wrapping
+            values.push_back(i == 0 ? zigzag(neighbors[0] - node) : neighbors[i] - neighbors[i - 1]);
+        }
+        StreamVByte::encode(values, bytes);
+        if (weighted)
+        {
+            StreamVByte::encode(csrGraph.weights(node), bytes);
+        }
+    }
+    bytes.resize(bytes.size() + StreamVByte::padding, 0);
+    bytes.shrink_to_fit();
+
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        if (csrGraph.originalId(node) != node)
+        {
+            originalIds.resize(nodesCount);
+            for (NodeId i = 0; i < nodesCount; i++)
+            {
+                originalIds[i] = csrGraph.originalId(i);
+            }
+            break;
+        }
+    }
+}
+
+uint32_t CompressedGraph::nodesAmount() const {
+    return nodesCount;
+}
+
+uint32_t CompressedGraph::nodeDegree(NodeId node) const {
+    if (node >= nodesAmount())
+    {
+        return 0;
+    }
+    const auto* row = rowStart(node);
+    return readDegree(row);
+}
+
+uint64_t CompressedGraph::edgesAmount() const {
+    return arcs;
+}
+
+bool CompressedGraph::isWeighted() const {
+    return weighted;
+}
+
+std::size_t CompressedGraph::memoryUsage() const {
+    return blockOffsets.capacity() * sizeof(uint64_t) + bytes.capacity() + originalIds.capacity() * sizeof(NodeId);
+}
+
+NodeId CompressedGraph::originalId(NodeId node) const {
+    return originalIds.empty() ? node : originalIds[node];
+}
+
+const Metadata& CompressedGraph::metadata() const {
+    return meta;
+}
+
+std::span<const NodeId> CompressedGraph::decodeNeighbors(NodeId node, std::vector<NodeId>& buffer) const {
+    const auto* row = rowStart(node);
+    const auto degree = readDegree(row);
+    buffer.clear();
+    buffer.reserve(degree);
+    decodeRow(node, row, degree, [&buffer](NodeId neighbor) {
+        buffer.push_back(neighbor);
+    });
+    return buffer;
+}
+
+std::span<const uint32_t> CompressedGraph::decodeWeights(NodeId node, std::vector<uint32_t>& buffer) const {
+    buffer.clear();
+    const auto* row = rowStart(node);
+    const auto degree = readDegree(row);
+    if (weighted)
+    {
+        StreamVByte::decode(StreamVByte::skip(row, degree), degree, [&buffer](uint32_t weight) {
+            buffer.push_back(weight);
+        });
+    }
+    return buffer;
+}
+
+CsrGraph CompressedGraph::toCsr() const {
+    std::pmr::vector<CsrGraph::Offset> csrOffsets(static_cast<std::size_t>(nodesCount) + 1, 0);
+    std::pmr::vector<NodeId> adjacency;
+    adjacency.reserve(arcs);
+    std::pmr::vector<uint32_t> weights;
+    weights.reserve(weighted ? arcs : 0);
+
+    // rows are stored back to back, so one pass needs no block lookups
+    const auto* row = bytes.data();
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        const auto degree = readDegree(row);
+        row = decodeRow(node, row, degree, [&adjacency](NodeId neighbor) {
+            adjacency.push_back(neighbor);
+        });
+        if (weighted)
+        {
+            row = StreamVByte::decode(row, degree, [&weights](uint32_t weight) {
+                weights.push_back(weight);
+            });
+        }
+        csrOffsets[node + 1] = adjacency.size();
+    }
+
+    CsrGraph csrGraph(std::move(csrOffsets), std::move(adjacency), std::move(weights), {originalIds.begin(), originalIds.end()});
+    csrGraph.metadata() = meta;
+    return csrGraph;
+}
+
+EdgeInfo CompressedGraph::findEdge(const EdgeInfo& edge) const {
+    if (edge.source >= nodesAmount() or edge.destination >= nodesAmount())
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    std::vector<NodeId> neighbors;
+    decodeNeighbors(edge.source, neighbors);
+    auto neighbor = std::ranges::lower_bound(neighbors, edge.destination);
+    if (neighbor == neighbors.end() or *neighbor != edge.destination)
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+    if (not weighted)
+    {
+        return {edge.source, edge.destination, 1};
+    }
+
+    std::vector<uint32_t> weights;
+    decodeWeights(edge.source, weights);
+    return {edge.source, edge.destination, weights[static_cast<std::size_t>(neighbor - neighbors.begin())]};
+}
+
+void CompressedGraph::setEdge(const EdgeInfo&) {
+    throw std::logic_error("CompressedGraph is immutable");
+}
+
+void CompressedGraph::addNodes(uint32_t) {
+    throw std::logic_error("CompressedGraph is immutable");
+}
+
+void CompressedGraph::removeNode(NodeId) {
+    throw std::logic_error("CompressedGraph is immutable");
+}
+
+void CompressedGraph::removeEdge(const EdgeInfo&) {
+    throw std::logic_error("CompressedGraph is immutable");
+}
+
+std::vector<NodeId> CompressedGraph::getNodeIds() const {
+    std::vector<NodeId> nodeIds(nodesAmount());
+    for (uint32_t i = 0; i < nodeIds.size(); i++)
+    {
+        nodeIds[i] = i;
+    }
+    return nodeIds;
+}
+
+std::vector<NodeId> CompressedGraph::getNeighborsOf(NodeId node) const {
+    std::vector<NodeId> neighbors;
+    if (node < nodesAmount())
+    {
+        decodeNeighbors(node, neighbors);
+    }
+    return neighbors;
+}
+
+std::string CompressedGraph::show() const {
+    std::stringstream outStream;
+    outStream << "Nodes amount = " << nodesAmount() << "\n{\n";
+    for (NodeId node = 0; node < nodesAmount(); node++)
+    {
+        outStream << node << ": ";
+        forEachNeighbor(node, [&outStream](NodeId neighbor) {
+            outStream << neighbor << ", ";
+        });
+        outStream << "\n";
+    }
+    outStream << "}\n";
+    return outStream.str();
+}
+} // namespace Graphs
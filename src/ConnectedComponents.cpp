@@ -0,0 +1,223 @@
+// this
+#include <Graphs/ConnectedComponents.hpp>
+
+// libraries
+#include <algorithm>
+#include <atomic>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/DisjointSets.hpp>
+#include <Graphs/Parallel.hpp>
+#include <optional>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+struct Run
+{
+    uint32_t begin;
+    uint32_t end;
+};
+
+using AtomicParents = std::vector<std::atomic<uint32_t>>;
+
+uint32_t findRoot(AtomicParents& parents, uint32_t node) {
+    while (true)
+    {
+        auto parent = parents[node].load(std::memory_order_relaxed);
+        if (parent == node)
+        {
+            return node;
+        }
+        auto grandParent = parents[parent].load(std::memory_order_relaxed);
+        if (grandParent != parent)
+        {
+            // path halving, every ancestor is a valid parent
+            parents[node].store(grandParent, std::memory_order_relaxed);
+        }
+        node = grandParent;
+    }
+}
+
+void hookRoots(AtomicParents& parents, uint32_t lhs, uint32_t rhs) {
+    while (true)
+    {
+        lhs = findRoot(parents, lhs);
+        rhs = findRoot(parents, rhs);
+        if (lhs == rhs)
+        {
+            return;
+        }
+        if (lhs < rhs)
+        {
+            std::swap(lhs, rhs);
+        }
+        // the larger root goes under the smaller one, which rules out cycles
+        uint32_t expected = lhs;
+        if (parents[lhs].compare_exchange_strong(expected, rhs, std::memory_order_acq_rel))
+        {
+            return;
+        }
+    }
+}
+
+std::vector<uint32_t> parallelRoots(const CsrGraph& graph, uint32_t threadsCount) {
+    const auto nodesCount = graph.nodesAmount();
+    AtomicParents parents(nodesCount);
+
+    Parallel::forEachChunk(0, nodesCount, threadsCount, [&parents](uint64_t begin, uint64_t end, uint32_t) {
+        for (auto node = begin; node < end; node++)
+        {
+            parents[node].store(static_cast<uint32_t>(node), std::memory_order_relaxed);
+        }
+    });
+
+    Parallel::forEachChunk(0, nodesCount, threadsCount, [&parents, &graph](uint64_t begin, uint64_t end, uint32_t) {
+        for (auto node = static_cast<NodeId>(begin); node < end; node++)
+        {
+            for (auto neighbor : graph.neighbors(node))
+            {
+                hookRoots(parents, node, neighbor);
+            }
+        }
+    });
+
+    std::vector<uint32_t> roots(nodesCount);
+    Parallel::forEachChunk(0, nodesCount, threadsCount, [&parents, &roots](uint64_t begin, uint64_t end, uint32_t) {
+        for (auto node = begin; node < end; node++)
+        {
+            roots[node] = findRoot(parents, static_cast<uint32_t>(node));
+        }
+    });
+    return roots;
+}
+
+std::vector<uint32_t> sequentialRoots(const CsrGraph& graph) {
+    DisjointSets sets(graph.nodesAmount());
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        for (auto neighbor : graph.neighbors(node))
+        {
+            sets.unite(node, neighbor);
+        }
+    }
+
+    std::vector<uint32_t> roots(graph.nodesAmount());
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        roots[node] = sets.find(node);
+    }
+    return roots;
+}
+} // namespace
+
+void ConnectedComponents::operator()(const Graphs::Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+
+    auto roots = method == Method::parallel ? parallelRoots(csrGraph, threadsCount) : sequentialRoots(csrGraph);
+
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        maxNodeId = std::max(maxNodeId, csrGraph.originalId(node));
+    }
+
+    std::vector<uint32_t> rootLabels(nodesCount, ComponentLabels::noComponent);
+    result->labels.assign(nodesCount == 0 ? 0 : static_cast<std::size_t>(maxNodeId) + 1, ComponentLabels::noComponent);
+    result->sizes.clear();
+
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        auto& label = rootLabels[roots[node]];
+        if (label == ComponentLabels::noComponent)
+        {
+            label = static_cast<uint32_t>(result->sizes.size());
+            result->sizes.push_back(0);
+        }
+        result->labels[csrGraph.originalId(node)] = label;
+        result->sizes[label]++;
+    }
+}
+
+/*
+        First pass encodes every row as runs of open pixels and unites runs
+        touching runs of the previous row, second pass writes the labels.
+        The union-find works on runs, which are far fewer than pixels.
+*/
+void ConnectedComponents::operator()(const Data::Pixel_map& map, GridGraph::Connectivity connectivity) {
+    const auto rows = map.get_rows();
+    const auto columns = map.get_columns();
+    const uint32_t reach = connectivity == GridGraph::Connectivity::eight ? 1 : 0;
+
+    std::vector<Run> runs;
+    std::vector<std::size_t> rowRuns(rows + 1, 0);
+    for (uint32_t row = 0; row < rows; row++)
+    {
+        rowRuns[row] = runs.size();
+        for (uint32_t column = 0; column < columns; column++)
+        {
+            if (map.get_field(row, column) != 0)
+            {
+                continue;
+            }
+            if (runs.size() > rowRuns[row] and runs.back().end == column)
+            {
+                runs.back().end++;
+            }
+            else
+            {
+                runs.push_back({column, column + 1});
+            }
+        }
+    }
+    rowRuns[rows] = runs.size();
+
+    DisjointSets sets(static_cast<uint32_t>(runs.size()));
+    for (uint32_t row = 1; row < rows; row++)
+    {
+        auto upper = rowRuns[row - 1];
+        auto lower = rowRuns[row];
+        while (upper < rowRuns[row] and lower < rowRuns[row + 1])
+        {
+            const auto& upperRun = runs[upper];
+            const auto& lowerRun = runs[lower];
+            if (upperRun.begin < lowerRun.end + reach and lowerRun.begin < upperRun.end + reach)
+            {
+                sets.unite(static_cast<uint32_t>(upper), static_cast<uint32_t>(lower));
+            }
+            // the run ending first cannot touch any further run of the other row
+            if (upperRun.end < lowerRun.end)
+            {
+                upper++;
+            }
+            else
+            {
+                lower++;
+            }
+        }
+    }
+
+    std::vector<uint32_t> rootLabels(runs.size(), ComponentLabels::noComponent);
+    result->labels.assign(static_cast<std::size_t>(rows) * columns, ComponentLabels::noComponent);
+    result->sizes.clear();
+
+    for (uint32_t row = 0; row < rows; row++)
+    {
+        for (auto i = rowRuns[row]; i < rowRuns[row + 1]; i++)
+        {
+            auto& label = rootLabels[sets.find(static_cast<uint32_t>(i))];
+            if (label == ComponentLabels::noComponent)
+            {
+                label = static_cast<uint32_t>(result->sizes.size());
+                result->sizes.push_back(0);
+            }
+
+            auto first = result->labels.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(row) * columns);
+            std::fill(first + runs[i].begin, first + runs[i].end, label);
+            result->sizes[label] += runs[i].end - runs[i].begin;
+        }
+    }
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,74 @@
+// this
+#include <Graphs/CoreDecomposition.hpp>
+
+// libraries
+#include <algorithm>
+#include <Graphs/LineGraph.hpp>
+
+namespace Graphs::Algorithm
+{
+void CoreDecomposition::operator()(const Graphs::Graph& graph) {
+    const EdgeIndex index(graph);
+    const auto nodesCount = index.nodesAmount();
+    const auto maxDegree = index.maxDegree();
+
+    std::vector<uint32_t> degrees(nodesCount);
+    std::vector<uint32_t> bucketStarts(static_cast<std::size_t>(maxDegree) + 2, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        degrees[node] = static_cast<uint32_t>(index.incidentEdges(node).size());
+        bucketStarts[degrees[node] + 1]++;
+    }
+    for (std::size_t degree = 1; degree < bucketStarts.size(); degree++)
+    {
+        bucketStarts[degree] += bucketStarts[degree - 1];
+    }
+
+    // nodes sorted by current degree, a node moves one bucket down by swapping with the bucket head
+    std::vector<NodeId> sorted(nodesCount);
+    std::vector<uint32_t> positions(nodesCount);
+    std::vector<uint32_t> cursors(bucketStarts.begin(), bucketStarts.end() - 1);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        positions[node] = cursors[degrees[node]]++;
+        sorted[positions[node]] = node;
+    }
+
+    for (uint32_t i = 0; i < nodesCount; i++)
+    {
+        auto node = sorted[i];
+        for (auto edge : index.incidentEdges(node))
+        {
+            auto [lower, higher] = index.endpoints(edge);
+            auto neighbor = lower == node ? higher : lower;
+            if (degrees[neighbor] <= degrees[node])
+            {
+                continue;
+            }
+
+            auto& bucketHead = bucketStarts[degrees[neighbor]];
+            auto headNode = sorted[bucketHead];
+            std::swap(sorted[positions[neighbor]], sorted[bucketHead]);
+            std::swap(positions[neighbor], positions[headNode]);
+            bucketHead++;
+            degrees[neighbor]--;
+        }
+    }
+
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        maxNodeId = std::max(maxNodeId, index.originalId(node));
+    }
+    result->coreNumbers.assign(nodesCount == 0 ? 0 : static_cast<std::size_t>(maxNodeId) + 1, 0);
+    result->removalOrder.resize(nodesCount);
+    result->degeneracy = 0;
+    for (uint32_t i = 0; i < nodesCount; i++)
+    {
+        auto node = sorted[i];
+        result->coreNumbers[index.originalId(node)] = degrees[node];
+        result->removalOrder[i] = index.originalId(node);
+        result->degeneracy = std::max(result->degeneracy, degrees[node]);
+    }
+}
+} // namespace Graphs::Algorithm
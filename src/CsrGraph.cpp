@@ -0,0 +1,552 @@
+// this
+#include <Graphs/CsrGraph.hpp>
+
+// libraries
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <Graphs/CompressedGraph.hpp>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Graphs
+{
+namespace
+{
+constexpr char csrMagic[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+constexpr uint32_t csrVersion = 1;
+constexpr uint32_t weightedFlag = 1;
+
+template <class T>
+void writeValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+T readValue(std::ifstream& file) {
+    T value{};
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+void writeString(std::ofstream& file, const std::string& value) {
+    writeValue(file, static_cast<uint32_t>(value.size()));
+    file.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+uint64_t remainingBytes(std::ifstream& file) {
+    auto position = file.tellg();
+    file.seekg(0, std::ios::end);
+    auto end = file.tellg();
+    file.seekg(position);
+    return position < 0 or end < position ? 0 : static_cast<uint64_t>(end - position);
+}
+
+std::string readString(std::ifstream& file) {
+    auto size = readValue<uint32_t>(file);
+    if (size > remainingBytes(file))
+    {
+        throw std::runtime_error("Truncated binary graph file");
+    }
+    std::string value(size, '\0');
+    file.read(value.data(), static_cast<std::streamsize>(value.size()));
+    return value;
+}
+
+template <class T>
+void writeRange(std::ofstream& file, const std::pmr::vector<T>& range) {
+    file.write(reinterpret_cast<const char*>(range.data()), static_cast<std::streamsize>(range.size() * sizeof(T)));
+}
+
+template <class T>
+void readRange(std::ifstream& file, std::pmr::vector<T>& range, uint64_t size) {
+    range.resize(size);
+    file.read(reinterpret_cast<char*>(range.data()), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+const char* skipSpaces(const char* itr, const char* end) {
+    while (itr != end and (*itr == ' ' or *itr == '\t' or *itr == '\r'))
+    {
+        itr++;
+    }
+    return itr;
+}
+
+const char* parseNumber(const char* itr, const char* end, uint32_t& value) {
+    value = 0;
+    while (itr != end and *itr >= '0' and *itr <= '9')
+    {
+        auto digit = static_cast<uint32_t>(*itr - '0');
+        if (value > (std::numeric_limits<uint32_t>::max() - digit) / 10)
+        {
+            throw std::runtime_error("Malformed adjacency list line");
+        }
+        value = value * 10 + digit;
+        itr++;
+    }
+    return itr;
+}
+
+std::string trim(const std::string& value) {
+    auto first = value.find_first_not_of(" \t\r");
+    auto last = value.find_last_not_of(" \t\r");
+    return first == std::string::npos ? std::string{} : value.substr(first, last - first + 1);
+}
+} // namespace
+
+void CsrGraph::buildFromEdges(uint32_t nodesCount, std::span<const EdgeInfo> edges) {
+    bool weighted = std::ranges::any_of(edges, [](const auto& edge) {
+        return edge.weight.value_or(1) != 1;
+    });
+
+    offsets.assign(nodesCount + 1, 0);
+    for (const auto& edge : edges)
+    {
+        if (edge.source >= nodesCount or edge.destination >= nodesCount)
+        {
+            throw std::out_of_range("Edge endpoint exceeds the nodes amount");
+        }
+        offsets[edge.source + 1]++;
+    }
+    for (uint32_t i = 0; i < nodesCount; i++)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    adjacency.resize(edges.size());
+    adjacencyWeights.resize(weighted ? edges.size() : 0);
+
+    std::vector<Offset> cursor(offsets.begin(), offsets.end() - 1);
+    for (const auto& edge : edges)
+    {
+        auto position = cursor[edge.source]++;
+        adjacency[position] = edge.destination;
+        if (weighted)
+        {
+            adjacencyWeights[position] = edge.weight.value_or(1);
+        }
+    }
+
+    std::vector<std::pair<NodeId, uint32_t>> row;
+    for (uint32_t i = 0; i < nodesCount; i++)
+    {
+        auto first = adjacency.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+        auto last = adjacency.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+        if (not weighted)
+        {
+            std::sort(first, last);
+            continue;
+        }
+
+        row.clear();
+        for (auto j = offsets[i]; j < offsets[i + 1]; j++)
+        {
+            row.emplace_back(adjacency[j], adjacencyWeights[j]);
+        }
+        std::ranges::sort(row);
+        for (auto j = offsets[i]; j < offsets[i + 1]; j++)
+        {
+            adjacency[j] = row[j - offsets[i]].first;
+            adjacencyWeights[j] = row[j - offsets[i]].second;
+        }
+    }
+}
+
+void CsrGraph::buildFromLstFile(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (not file.good())
+    {
+        throw std::runtime_error("Error opening file");
+    }
+
+    auto fileContent = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    std::vector<EdgeInfo> edges;
+    uint32_t nodesCount = 0;
+
+    const char* itr = fileContent.data();
+    const char* end = itr + fileContent.size();
+    while (itr < end)
+    {
+        const char* lineEnd = std::find(itr, end, '\n');
+        const char* cursor = skipSpaces(itr, lineEnd);
+
+        if (cursor != lineEnd and *cursor == '#')
+        {
+            std::string line(cursor + 1, lineEnd);
+            auto separator = line.find(':');
+            if (separator != std::string::npos)
+            {
+                meta[trim(line.substr(0, separator))] = trim(line.substr(separator + 1));
+            }
+        }
+        else if (cursor != lineEnd)
+        {
+            uint32_t source = 0;
+            cursor = parseNumber(cursor, lineEnd, source);
+            if (cursor == lineEnd or *cursor != ':' or source == 0)
+            {
+                throw std::runtime_error("Malformed adjacency list line");
+            }
+            nodesCount = std::max(nodesCount, source);
+
+            cursor = skipSpaces(cursor + 1, lineEnd);
+            while (cursor != lineEnd)
+            {
+                uint32_t destination = 0;
+                const char* next = parseNumber(cursor, lineEnd, destination);
+                if (next == cursor or destination == 0)
+                {
+                    throw std::runtime_error("Malformed adjacency list line");
+                }
+                nodesCount = std::max(nodesCount, destination);
+                edges.push_back({source - 1, destination - 1, std::nullopt});
+                cursor = skipSpaces(next, lineEnd);
+            }
+        }
+        itr = lineEnd == end ? end : lineEnd + 1;
+    }
+
+    buildFromEdges(nodesCount, edges);
+}
+
+void CsrGraph::buildFromCsrFile(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (not file.good())
+    {
+        throw std::runtime_error("Error opening file");
+    }
+
+    char magic[sizeof(csrMagic)] = {};
+    file.read(magic, sizeof(magic));
+    if (std::memcmp(magic, csrMagic, sizeof(csrMagic)) != 0 or readValue<uint32_t>(file) != csrVersion)
+    {
+        throw std::runtime_error("Unsupported binary graph file");
+    }
+
+    auto flags = readValue<uint32_t>(file);
+    auto nodesCount = readValue<uint64_t>(file);
+    auto entriesCount = readValue<uint64_t>(file);
+    auto metadataCount = readValue<uint32_t>(file);
+
+    for (uint32_t i = 0; i < metadataCount; i++)
+    {
+        auto key = readString(file);
+        meta[key] = readString(file);
+    }
+
+    // The header counts are validated against the file size before anything
+    // is allocated, so a corrupt header fails cleanly instead of with bad_alloc
+    const uint64_t entrySize = (flags & weightedFlag) ? sizeof(NodeId) + sizeof(uint32_t) : sizeof(NodeId);
+    const uint64_t available = file.good() ? remainingBytes(file) : 0;
+    if (nodesCount > std::numeric_limits<uint32_t>::max() or (nodesCount + 1) * sizeof(Offset) > available or
+        entriesCount > (available - (nodesCount + 1) * sizeof(Offset)) / entrySize)
+    {
+        throw std::runtime_error("Truncated binary graph file");
+    }
+
+    readRange(file, offsets, nodesCount + 1);
+    readRange(file, adjacency, entriesCount);
+    if (flags & weightedFlag)
+    {
+        readRange(file, adjacencyWeights, entriesCount);
+    }
+
+    if (not file.good() or offsets.back() != entriesCount)
+    {
+        throw std::runtime_error("Truncated binary graph file");
+    }
+
+    // Traversals index adjacency through offsets without bounds checks, so
+    // the row structure has to be consistent before the graph is usable
+    if (offsets.front() != 0 or not std::is_sorted(offsets.begin(), offsets.end()) or
+        std::any_of(adjacency.begin(), adjacency.end(), [&](NodeId node) { return node >= nodesCount; }))
+    {
+        throw std::runtime_error("Corrupt binary graph file");
+    }
+}
+
+CsrGraph::CsrGraph(std::string filePath, std::pmr::memory_resource* resource)
+    : offsets(1, 0, resource), adjacency(resource), adjacencyWeights(resource), originalIds(resource) {
+    auto extension = std::filesystem::path(filePath).extension().string();
+
+    if (extension == ".lst")
+    {
+        buildFromLstFile(filePath);
+    }
+    else if (extension == ".csr")
+    {
+        buildFromCsrFile(filePath);
+    }
+    else
+    {
+        throw std::invalid_argument("Unsupported graph file extension");
+    }
+}
+
+CsrGraph::CsrGraph(const Graph& graph) {
+    auto nodeIds = graph.getNodeIds();
+
+    std::unordered_map<NodeId, NodeId> indices;
+    indices.reserve(nodeIds.size());
+    for (uint32_t i = 0; i < nodeIds.size(); i++)
+    {
+        indices.emplace(nodeIds[i], i);
+    }
+
+    std::vector<EdgeInfo> edges;
+    for (uint32_t i = 0; i < nodeIds.size(); i++)
+    {
+        for (auto neighbor : graph.getNeighborsOf(nodeIds[i]))
+        {
+            auto destination = indices.find(neighbor);
+            if (destination == indices.end())
+            {
+                continue;
+            }
+            auto weight = graph.findEdge({nodeIds[i], neighbor}).weight;
+            edges.push_back({i, destination->second, weight});
+        }
+    }
+
+    bool identity = true;
+    for (uint32_t i = 0; i < nodeIds.size(); i++)
+    {
+        identity = identity and nodeIds[i] == i;
+    }
+    if (not identity)
+    {
+        originalIds.assign(nodeIds.begin(), nodeIds.end());
+    }
+
+    buildFromEdges(static_cast<uint32_t>(indices.size()), edges);
+}
+
+CsrGraph::CsrGraph(uint32_t nodesCount, std::span<const EdgeInfo> edges, std::pmr::memory_resource* resource)
+    : offsets(1, 0, resource), adjacency(resource), adjacencyWeights(resource), originalIds(resource) {
+    buildFromEdges(nodesCount, edges);
+}
+
+/*
+        Adopts ready CSR arrays of a builder, rows are expected to be sorted.
+        Empty weights mean an unweighted graph, empty original ids mean that
+        node ids are their own original ids.
+*/
+CsrGraph::CsrGraph(std::pmr::vector<Offset> rowOffsets,
+                   std::pmr::vector<NodeId> neighbors,
+                   std::pmr::vector<uint32_t> neighborWeights,
+                   std::pmr::vector<NodeId> nodeOriginalIds)
+    : offsets(std::move(rowOffsets)),
+      adjacency(std::move(neighbors)),
+      adjacencyWeights(std::move(neighborWeights)),
+      originalIds(std::move(nodeOriginalIds)) {
+    if (offsets.empty() or offsets.back() != adjacency.size()
+        or (not adjacencyWeights.empty() and adjacencyWeights.size() != adjacency.size())
+        or (not originalIds.empty() and originalIds.size() != offsets.size() - 1))
+    {
+        throw std::invalid_argument("Inconsistent CSR arrays");
+    }
+}
+
+uint32_t CsrGraph::nodesAmount() const {
+    return static_cast<uint32_t>(offsets.size() - 1);
+}
+
+uint32_t CsrGraph::nodeDegree(NodeId node) const {
+    if (node >= nodesAmount())
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>(offsets[node + 1] - offsets[node]);
+}
+
+uint64_t CsrGraph::edgesAmount() const {
+    return adjacency.size();
+}
+
+std::size_t CsrGraph::memoryUsage() const {
+    return offsets.capacity() * sizeof(Offset) + adjacency.capacity() * sizeof(NodeId)
+         + adjacencyWeights.capacity() * sizeof(uint32_t) + originalIds.capacity() * sizeof(NodeId);
+}
+
+std::span<const NodeId> CsrGraph::neighbors(NodeId node) const {
+    return {adjacency.data() + offsets[node], adjacency.data() + offsets[node + 1]};
+}
+
+std::span<const uint32_t> CsrGraph::weights(NodeId node) const {
+    if (not isWeighted())
+    {
+        return {};
+    }
+    return {adjacencyWeights.data() + offsets[node], adjacencyWeights.data() + offsets[node + 1]};
+}
+
+bool CsrGraph::isWeighted() const {
+    return not adjacencyWeights.empty();
+}
+
+NodeId CsrGraph::originalId(NodeId node) const {
+    return originalIds.empty() ? node : originalIds[node];
+}
+
+const Metadata& CsrGraph::metadata() const {
+    return meta;
+}
+
+Metadata& CsrGraph::metadata() {
+    return meta;
+}
+
+EdgeInfo CsrGraph::findEdge(const EdgeInfo& edge) const {
+    if (edge.source >= nodesAmount() or edge.destination >= nodesAmount())
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    auto range = neighbors(edge.source);
+    auto neighbor = std::ranges::lower_bound(range, edge.destination);
+    if (neighbor == range.end() or *neighbor != edge.destination)
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    auto position = static_cast<std::size_t>(neighbor - range.begin());
+    return {edge.source, edge.destination, isWeighted() ? weights(edge.source)[position] : 1};
+}
+
+void CsrGraph::setEdge(const EdgeInfo&) {
+    throw std::logic_error("CsrGraph is immutable");
+}
+
+void CsrGraph::addNodes(uint32_t) {
+    throw std::logic_error("CsrGraph is immutable");
+}
+
+void CsrGraph::removeNode(NodeId) {
+    throw std::logic_error("CsrGraph is immutable");
+}
+
+void CsrGraph::removeEdge(const EdgeInfo&) {
+    throw std::logic_error("CsrGraph is immutable");
+}
+
+std::vector<NodeId> CsrGraph::getNodeIds() const {
+    std::vector<NodeId> nodeIds(nodesAmount());
+    for (uint32_t i = 0; i < nodeIds.size(); i++)
+    {
+        nodeIds[i] = i;
+    }
+    return nodeIds;
+}
+
+std::vector<NodeId> CsrGraph::getNeighborsOf(NodeId node) const {
+    if (node >= nodesAmount())
+    {
+        return {};
+    }
+    auto range = neighbors(node);
+    return {range.begin(), range.end()};
+}
+
+void CsrGraph::saveLstFile(const std::string& filePath) const {
+    std::ofstream file(filePath);
+    if (not file.good())
+    {
+        throw std::runtime_error("Error opening file");
+    }
+
+    for (const auto& [key, value] : meta)
+    {
+        file << "# " << key << ": " << value << "\n";
+    }
+
+    std::string line;
+    for (uint32_t i = 0; i < nodesAmount(); i++)
+    {
+        line = std::to_string(i + 1) + ":";
+        for (auto neighbor : neighbors(i))
+        {
+            line += ' ';
+            line += std::to_string(neighbor + 1);
+        }
+        line += '\n';
+        file << line;
+    }
+}
+
+void CsrGraph::saveCsrFile(const std::string& filePath) const {
+    std::ofstream file(filePath, std::ios::binary);
+    if (not file.good())
+    {
+        throw std::runtime_error("Error opening file");
+    }
+
+    file.write(csrMagic, sizeof(csrMagic));
+    writeValue(file, csrVersion);
+    writeValue(file, isWeighted() ? weightedFlag : 0u);
+    writeValue(file, static_cast<uint64_t>(nodesAmount()));
+    writeValue(file, static_cast<uint64_t>(adjacency.size()));
+    writeValue(file, static_cast<uint32_t>(meta.size()));
+    for (const auto& [key, value] : meta)
+    {
+        writeString(file, key);
+        writeString(file, value);
+    }
+
+    writeRange(file, offsets);
+    writeRange(file, adjacency);
+    if (isWeighted())
+    {
+        writeRange(file, adjacencyWeights);
+    }
+}
+
+void CsrGraph::save(const std::string& filePath) const {
+    auto extension = std::filesystem::path(filePath).extension().string();
+
+    if (extension == ".lst")
+    {
+        saveLstFile(filePath);
+    }
+    else if (extension == ".csr")
+    {
+        saveCsrFile(filePath);
+    }
+    else
+    {
+        throw std::invalid_argument("Unsupported graph file extension");
+    }
+}
+
+const CsrGraph& CsrGraph::from(const Graph& graph, std::optional<CsrGraph>& holder) {
+    if (auto csrGraph = dynamic_cast<const CsrGraph*>(&graph))
+    {
+        return *csrGraph;
+    }
+    if (auto compressedGraph = dynamic_cast<const CompressedGraph*>(&graph))
+    {
+        return holder.emplace(compressedGraph->toCsr());
+    }
+    return holder.emplace(graph);
+}
+
+std::string CsrGraph::show() const {
+    std::stringstream outStream;
+    outStream << "Nodes amount = " << nodesAmount() << "\n{\n";
+
+    for (uint32_t i = 0; i < nodesAmount(); i++)
+    {
+        outStream << i << ": ";
+        for (auto neighbor : neighbors(i))
+        {
+            outStream << neighbor << ", ";
+        }
+        outStream << "\n";
+    }
+    outStream << "}\n";
+    return outStream.str();
+}
+} // namespace Graphs
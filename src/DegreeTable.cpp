@@ -0,0 +1,55 @@
+// this
+#include <Graphs/DegreeTable.hpp>
+
+namespace Graphs
+{
+void DegreeTable::move(uint32_t from, uint32_t to) {
+    if (to >= histogram.size())
+    {
+        histogram.resize(static_cast<std::size_t>(to) + 1, 0);
+    }
+    histogram[from]--;
+    histogram[to]++;
+
+    if (to > maximum)
+    {
+        maximum = to;
+    }
+    while (maximum > 0 and histogram[maximum] == 0)
+    {
+        maximum--;
+    }
+}
+
+void DegreeTable::resize(std::size_t nodesCount) {
+    // dropped nodes leave the histogram through degree 0, like added nodes enter it
+    for (auto i = nodesCount; i < values.size(); i++)
+    {
+        move(values[i], 0);
+    }
+    if (nodesCount < values.size())
+    {
+        histogram[0] -= static_cast<uint32_t>(values.size() - nodesCount);
+    }
+    else
+    {
+        histogram[0] += static_cast<uint32_t>(nodesCount - values.size());
+    }
+    values.resize(nodesCount, 0);
+}
+
+void DegreeTable::increment(NodeId node) {
+    move(values[node], values[node] + 1);
+    values[node]++;
+}
+
+void DegreeTable::decrement(NodeId node) {
+    move(values[node], values[node] - 1);
+    values[node]--;
+}
+
+void DegreeTable::set(NodeId node, uint32_t degree) {
+    move(values[node], degree);
+    values[node] = degree;
+}
+} // namespace Graphs
@@ -0,0 +1,59 @@
+// this
+#include <Graphs/DisjointSets.hpp>
+
+// libraries
+#include <numeric>
+#include <utility>
+
+namespace Graphs
+{
+DisjointSets::DisjointSets(uint32_t size) {
+    reset(size);
+}
+
+void DisjointSets::reset(uint32_t size) {
+    parents.resize(size);
+    std::iota(parents.begin(), parents.end(), 0u);
+    sizes.assign(size, 1);
+    sets = size;
+}
+
+uint32_t DisjointSets::find(uint32_t element) {
+    while (parents[element] != element)
+    {
+        parents[element] = parents[parents[element]];
+        element = parents[element];
+    }
+    return element;
+}
+
+bool DisjointSets::unite(uint32_t lhs, uint32_t rhs) {
+    lhs = find(lhs);
+    rhs = find(rhs);
+    if (lhs == rhs)
+    {
+        return false;
+    }
+
+    if (sizes[lhs] < sizes[rhs])
+    {
+        std::swap(lhs, rhs);
+    }
+    parents[rhs] = lhs;
+    sizes[lhs] += sizes[rhs];
+    sets--;
+    return true;
+}
+
+uint32_t DisjointSets::setSize(uint32_t element) {
+    return sizes[find(element)];
+}
+
+uint32_t DisjointSets::setsAmount() const {
+    return sets;
+}
+
+uint32_t DisjointSets::size() const {
+    return static_cast<uint32_t>(parents.size());
+}
+} // namespace Graphs
@@ -0,0 +1,343 @@
+// this
+#include <Graphs/DynamicGraph.hpp>
+
+// libraries
+#include <algorithm>
+#include <bit>
+#include <sstream>
+#include <utility>
+
+namespace Graphs
+{
+std::size_t AdjacencySet::home(NodeId node) const {
+    // Fibonacci hashing spreads runs of consecutive ids over the whole table
+    const auto shift = 64 - std::countr_zero(slots.size());
+    return static_cast<std::size_t>((node * 0x9E3779B97F4A7C15ull) >> shift);
+}
+
+std::size_t AdjacencySet::locate(NodeId node) const {
+    const auto mask = slots.size() - 1;
+    auto index = home(node);
+    while (slots[index].neighbor != node and slots[index].neighbor != empty)
+    {
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+void AdjacencySet::rehash(std::size_t capacity) {
+    auto previous = std::move(slots);
+    slots.assign(capacity, {empty, 0});
+    occupied = count;
+
+    const auto mask = capacity - 1;
+    for (const auto& slot : previous)
+    {
+        if (slot.neighbor >= erased)
+        {
+            continue;
+        }
+        auto index = home(slot.neighbor);
+        while (slots[index].neighbor != empty)
+        {
+            index = (index + 1) & mask;
+        }
+        slots[index] = slot;
+    }
+}
+
+std::optional<uint32_t> AdjacencySet::find(NodeId node) const {
+    if (slots.empty())
+    {
+        return std::nullopt;
+    }
+    const auto& slot = slots[locate(node)];
+    return slot.neighbor == node ? std::make_optional(slot.weight) : std::nullopt;
+}
+
+std::optional<uint32_t> AdjacencySet::insert(NodeId node, uint32_t weight) {
+    if (not slots.empty())
+    {
+        auto& slot = slots[locate(node)];
+        if (slot.neighbor == node)
+        {
+            return std::exchange(slot.weight, weight);
+        }
+    }
+
+    if ((static_cast<std::size_t>(occupied) + 1) * 4 > slots.size() * 3)
+    {
+        // also purges erased slots when the set did not actually grow
+        rehash(std::max<std::size_t>(8, std::bit_ceil((static_cast<std::size_t>(count) + 1) * 2)));
+    }
+
+    const auto mask = slots.size() - 1;
+    auto index = home(node);
+    while (slots[index].neighbor != empty and slots[index].neighbor != erased)
+    {
+        index = (index + 1) & mask;
+    }
+    if (slots[index].neighbor == empty)
+    {
+        occupied++;
+    }
+    slots[index] = {node, weight};
+    count++;
+    return std::nullopt;
+}
+
+std::optional<uint32_t> AdjacencySet::erase(NodeId node) {
+    if (slots.empty())
+    {
+        return std::nullopt;
+    }
+    auto& slot = slots[locate(node)];
+    if (slot.neighbor != node)
+    {
+        return std::nullopt;
+    }
+    slot.neighbor = erased;
+    count--;
+    return slot.weight;
+}
+
+void AdjacencySet::clear() {
+    slots.clear();
+    slots.shrink_to_fit();
+    count = 0;
+    occupied = 0;
+}
+
+DynamicGraph::DynamicGraph(uint32_t nodesCount, std::pmr::memory_resource* resource)
+    : outArcs(nodesCount, resource), inArcs(nodesCount, resource), alive(nodesCount, true), liveNodes(nodesCount) {}
+
+/* Keeps the node ids of the source graph, ids missing in it become removed nodes */
+DynamicGraph::DynamicGraph(const Graph& graph, std::pmr::memory_resource* resource) : outArcs(resource), inArcs(resource) {
+    auto nodeIds = graph.getNodeIds();
+    auto maxNodeId = nodeIds.empty() ? 0 : *std::ranges::max_element(nodeIds);
+    auto nodesCount = nodeIds.empty() ? 0 : static_cast<std::size_t>(maxNodeId) + 1;
+
+    outArcs.resize(nodesCount);
+    inArcs.resize(nodesCount);
+    alive.assign(nodesCount, false);
+    for (auto nodeId : nodeIds)
+    {
+        alive[nodeId] = true;
+    }
+    liveNodes = static_cast<uint32_t>(nodeIds.size());
+
+    for (auto nodeId : nodeIds)
+    {
+        for (auto neighbor : graph.getNeighborsOf(nodeId))
+        {
+            setEdge({nodeId, neighbor, graph.findEdge({nodeId, neighbor}).weight});
+        }
+    }
+}
+
+bool DynamicGraph::isAlive(NodeId node) const {
+    return node < alive.size() and alive[node];
+}
+
+uint32_t DynamicGraph::nodesAmount() const {
+    return liveNodes;
+}
+
+uint32_t DynamicGraph::nodeDegree(NodeId node) const {
+    return isAlive(node) ? outArcs[node].size() : 0;
+}
+
+uint64_t DynamicGraph::edgesAmount() const {
+    return arcs;
+}
+
+EdgeInfo DynamicGraph::findEdge(const EdgeInfo& edge) const {
+    if (not isAlive(edge.source) or not isAlive(edge.destination))
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+    return {edge.source, edge.destination, outArcs[edge.source].find(edge.destination)};
+}
+
+void DynamicGraph::setEdge(const EdgeInfo& edge) {
+    if (not isAlive(edge.source) or not isAlive(edge.destination))
+    {
+        return;
+    }
+
+    auto weight = edge.weight.value_or(1);
+    auto previous = outArcs[edge.source].insert(edge.destination, weight);
+    inArcs[edge.destination].insert(edge.source, weight);
+
+    if (previous.has_value())
+    {
+        nonUnitWeights -= previous.value() != 1 ? 1 : 0;
+    }
+    else
+    {
+        arcs++;
+    }
+    nonUnitWeights += weight != 1 ? 1 : 0;
+    markModified();
+}
+
+void DynamicGraph::removeEdge(const EdgeInfo& edge) {
+    if (not isAlive(edge.source) or not isAlive(edge.destination))
+    {
+        return;
+    }
+
+    auto weight = outArcs[edge.source].erase(edge.destination);
+    if (not weight.has_value())
+    {
+        return;
+    }
+    inArcs[edge.destination].erase(edge.source);
+    arcs--;
+    nonUnitWeights -= weight.value() != 1 ? 1 : 0;
+    markModified();
+}
+
+void DynamicGraph::addNodes(uint32_t nodesCount) {
+    outArcs.resize(outArcs.size() + nodesCount);
+    inArcs.resize(inArcs.size() + nodesCount);
+    alive.resize(alive.size() + nodesCount, true);
+    liveNodes += nodesCount;
+    markModified();
+}
+
+void DynamicGraph::removeNode(NodeId node) {
+    if (not isAlive(node))
+    {
+        return;
+    }
+
+    outArcs[node].forEach([this, node](NodeId neighbor, uint32_t weight) {
+        if (neighbor != node)
+        {
+            inArcs[neighbor].erase(node);
+        }
+        arcs--;
+        nonUnitWeights -= weight != 1 ? 1 : 0;
+    });
+    inArcs[node].forEach([this, node](NodeId neighbor, uint32_t) {
+        // a self-loop was already counted with the outgoing arcs
+        if (neighbor == node)
+        {
+            return;
+        }
+        auto weight = outArcs[neighbor].erase(node);
+        arcs--;
+        nonUnitWeights -= weight.value_or(1) != 1 ? 1 : 0;
+    });
+
+    outArcs[node].clear();
+    inArcs[node].clear();
+    alive[node] = false;
+    liveNodes--;
+    markModified();
+}
+
+std::vector<NodeId> DynamicGraph::getNodeIds() const {
+    std::vector<NodeId> nodeIds;
+    nodeIds.reserve(liveNodes);
+    for (NodeId node = 0; node < alive.size(); node++)
+    {
+        if (alive[node])
+        {
+            nodeIds.push_back(node);
+        }
+    }
+    return nodeIds;
+}
+
+std::vector<NodeId> DynamicGraph::getNeighborsOf(NodeId node) const {
+    std::vector<NodeId> neighbors;
+    if (not isAlive(node))
+    {
+        return neighbors;
+    }
+
+    neighbors.reserve(outArcs[node].size());
+    outArcs[node].forEach([&neighbors](NodeId neighbor, uint32_t) {
+        neighbors.push_back(neighbor);
+    });
+    std::ranges::sort(neighbors);
+    return neighbors;
+}
+
+/*
+        Live nodes get dense ids in increasing order of their own ids, the
+        rows are sorted while copying out of the hash sets. Weights are only
+        exported when some arc has a weight other than 1.
+*/
+CsrGraph DynamicGraph::toCsr() const {
+    std::vector<NodeId> denseIds(alive.size(), 0);
+    auto originalIds = getNodeIds();
+    for (NodeId i = 0; i < originalIds.size(); i++)
+    {
+        denseIds[originalIds[i]] = i;
+    }
+
+    std::pmr::vector<CsrGraph::Offset> offsets(originalIds.size() + 1, 0);
+    for (std::size_t i = 0; i < originalIds.size(); i++)
+    {
+        offsets[i + 1] = offsets[i] + outArcs[originalIds[i]].size();
+    }
+
+    const bool weighted = nonUnitWeights > 0;
+    std::pmr::vector<NodeId> adjacency(offsets.back());
+    std::pmr::vector<uint32_t> weights(weighted ? offsets.back() : 0);
+
+    std::vector<AdjacencySet::Slot> row;
+    for (std::size_t i = 0; i < originalIds.size(); i++)
+    {
+        row.clear();
+        outArcs[originalIds[i]].forEach([&row, &denseIds](NodeId neighbor, uint32_t weight) {
+            row.push_back({denseIds[neighbor], weight});
+        });
+        std::ranges::sort(row, {}, &AdjacencySet::Slot::neighbor);
+
+        for (std::size_t j = 0; j < row.size(); j++)
+        {
+            adjacency[offsets[i] + j] = row[j].neighbor;
+            if (weighted)
+            {
+                weights[offsets[i] + j] = row[j].weight;
+            }
+        }
+    }
+
+    if (originalIds.size() == alive.size())
+    {
+        originalIds.clear();
+    }
+    return CsrGraph(std::move(offsets), std::move(adjacency), std::move(weights), {originalIds.begin(), originalIds.end()});
+}
+
+std::size_t DynamicGraph::memoryUsage() const {
+    std::size_t usage = (outArcs.capacity() + inArcs.capacity()) * sizeof(AdjacencySet) + alive.capacity() / 8;
+    for (NodeId node = 0; node < outArcs.size(); node++)
+    {
+        usage += outArcs[node].memoryUsage() + inArcs[node].memoryUsage();
+    }
+    return usage;
+}
+
+std::string DynamicGraph::show() const {
+    std::stringstream outStream;
+    outStream << "Nodes amount = " << nodesAmount() << "\n{\n";
+
+    for (auto node : getNodeIds())
+    {
+        outStream << node << ": ";
+        for (auto neighbor : getNeighborsOf(node))
+        {
+            outStream << neighbor << ", ";
+        }
+        outStream << "\n";
+    }
+    outStream << "}\n";
+    return outStream.str();
+}
+} // namespace Graphs
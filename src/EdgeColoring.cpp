@@ -0,0 +1,196 @@
+// this
+#include <Graphs/EdgeColoring.hpp>
+
+// libraries
+#include <stdexcept>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+constexpr EdgeId noEdge = std::numeric_limits<EdgeId>::max();
+
+/*
+        Colors one edge at a time, keeping the coloring proper with at most
+        maxDegree+1 colors: builds a maximal fan around one endpoint, inverts
+        the alternating path of the two free colors and rotates the fan.
+*/
+class MisraGries
+{
+    public:
+    MisraGries(const EdgeIndex& index, std::vector<ColorId>& colors)
+        : index(index), colors(colors), colorMarks(index.maxDegree() + 1, 0), fanMarks(index.nodesAmount(), noEdge) {}
+
+    void colorEdge(EdgeId edge) {
+        auto [center, first] = index.endpoints(edge);
+        buildFan(edge, center, first);
+
+        auto centerFree = freeColor(center);
+        auto fanFree = freeColor(fan.back());
+        invertPath(center, centerFree, fanFree);
+
+        auto rotated = fanPrefixFreeOf(fanFree);
+        for (std::size_t i = 0; i < rotated; i++)
+        {
+            colors[fanEdges[i]] = colors[fanEdges[i + 1]];
+        }
+        colors[fanEdges[rotated]] = fanFree;
+    }
+
+    std::size_t memoryUsage() const {
+        return colorMarks.capacity() * sizeof(uint64_t) + fanMarks.capacity() * sizeof(EdgeId)
+             + (fan.capacity() + fanEdges.capacity() + path.capacity()) * sizeof(uint32_t);
+    }
+
+    private:
+    NodeId opposite(EdgeId edge, NodeId node) const {
+        auto [lower, higher] = index.endpoints(edge);
+        return lower == node ? higher : lower;
+    }
+
+    void markColorsAround(NodeId node) {
+        stamp++;
+        for (auto edge : index.incidentEdges(node))
+        {
+            if (colors[edge] != EdgeColoringResult::noColor)
+            {
+                colorMarks[colors[edge]] = stamp;
+            }
+        }
+    }
+
+    ColorId freeColor(NodeId node) {
+        markColorsAround(node);
+        ColorId color = 0;
+        while (colorMarks[color] == stamp)
+        {
+            color++;
+        }
+        return color;
+    }
+
+    EdgeId edgeWithColor(NodeId node, ColorId color) const {
+        for (auto edge : index.incidentEdges(node))
+        {
+            if (colors[edge] == color)
+            {
+                return edge;
+            }
+        }
+        return noEdge;
+    }
+
+    bool isFree(NodeId node, ColorId color) const {
+        return edgeWithColor(node, color) == noEdge;
+    }
+
+    // fan members are marked with the edge being colored, every edge is colored once
+    void buildFan(EdgeId edge, NodeId center, NodeId first) {
+        fan.assign(1, first);
+        fanEdges.assign(1, edge);
+        fanMarks[first] = edge;
+
+        bool extended = true;
+        while (extended)
+        {
+            extended = false;
+            markColorsAround(fan.back());
+            for (auto candidate : index.incidentEdges(center))
+            {
+                auto color = colors[candidate];
+                auto node = opposite(candidate, center);
+                if (color == EdgeColoringResult::noColor or colorMarks[color] == stamp or fanMarks[node] == edge)
+                {
+                    continue;
+                }
+                fan.push_back(node);
+                fanEdges.push_back(candidate);
+                fanMarks[node] = edge;
+                extended = true;
+                break;
+            }
+        }
+    }
+
+    // swaps the colors along the path starting at the node with an edge of the second color
+    void invertPath(NodeId node, ColorId centerFree, ColorId fanFree) {
+        path.clear();
+        auto color = fanFree;
+        for (auto edge = edgeWithColor(node, color); edge != noEdge; edge = edgeWithColor(node, color))
+        {
+            path.push_back(edge);
+            node = opposite(edge, node);
+            color = color == fanFree ? centerFree : fanFree;
+        }
+        for (auto edge : path)
+        {
+            colors[edge] = colors[edge] == fanFree ? centerFree : fanFree;
+        }
+    }
+
+    // position of the first fan member with the color free, among the members still forming a fan
+    std::size_t fanPrefixFreeOf(ColorId color) const {
+        for (std::size_t i = 0; i < fan.size(); i++)
+        {
+            if (i > 0 and not isFree(fan[i - 1], colors[fanEdges[i]]))
+            {
+                break;
+            }
+            if (isFree(fan[i], color))
+            {
+                return i;
+            }
+        }
+        throw std::logic_error("Misra-Gries fan without a free color");
+    }
+
+    const EdgeIndex& index;
+    std::vector<ColorId>& colors;
+    std::vector<uint64_t> colorMarks;
+    std::vector<EdgeId> fanMarks;
+    std::vector<NodeId> fan;
+    std::vector<EdgeId> fanEdges;
+    std::vector<EdgeId> path;
+    uint64_t stamp = 0;
+};
+} // namespace
+
+void EdgeColoring::operator()(const Graphs::Graph& graph) {
+    (*this)(EdgeIndex(graph));
+}
+
+void EdgeColoring::operator()(const EdgeIndex& index) {
+    switch (method)
+    {
+    case Method::misraGries:
+        colorMisraGries(index);
+        break;
+    case Method::lineGraph:
+        colorLineGraph(index);
+        break;
+    }
+}
+
+void EdgeColoring::colorLineGraph(const EdgeIndex& index) {
+    auto lineGraph = makeLineGraph(index);
+    auto coloring = std::make_shared<ColoringResult>();
+    GreedyColoring<notVerbose>{coloring}(lineGraph);
+
+    result->colors.assign(index.edgesAmount(), EdgeColoringResult::noColor);
+    for (const auto& [edge, color] : *coloring)
+    {
+        result->colors[edge] = color;
+    }
+    result->workingMemory = index.memoryUsage() + lineGraph.memoryUsage() + coloring->capacity() * sizeof(ColoringInfo);
+}
+
+void EdgeColoring::colorMisraGries(const EdgeIndex& index) {
+    result->colors.assign(index.edgesAmount(), EdgeColoringResult::noColor);
+    MisraGries coloring(index, result->colors);
+    for (EdgeId edge = 0; edge < index.edgesAmount(); edge++)
+    {
+        coloring.colorEdge(edge);
+    }
+    result->workingMemory = index.memoryUsage() + coloring.memoryUsage();
+}
+} // namespace Graphs::Algorithm
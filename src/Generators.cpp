@@ -0,0 +1,200 @@
+// this
+#include <Graphs/Generators.hpp>
+
+// libraries
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace Graphs::Generators
+{
+namespace
+{
+using Pair = std::pair<NodeId, NodeId>;
+
+std::vector<uint32_t> assignHiddenParts(uint32_t nodesCount, uint32_t partsCount, std::mt19937_64& engine) {
+    std::vector<NodeId> order(nodesCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::shuffle(order.begin(), order.end(), engine);
+
+    std::vector<uint32_t> partition(nodesCount);
+    for (uint32_t i = 0; i < nodesCount; i++)
+    {
+        partition[order[i]] = i % partsCount;
+    }
+    return partition;
+}
+
+/*
+        Samples every unordered pair of nodes with given probability in time
+        proportional to the amount of sampled pairs, by skipping geometrically
+        distributed gaps (Batagelj & Brandes).
+*/
+template <class Emit>
+void sampleUniformPairs(uint32_t nodesCount, double probability, std::mt19937_64& engine, Emit emit) {
+    if (probability <= 0.0)
+    {
+        return;
+    }
+
+    if (probability >= 1.0)
+    {
+        for (NodeId v = 1; v < nodesCount; v++)
+        {
+            for (NodeId w = 0; w < v; w++)
+            {
+                emit(v, w);
+            }
+        }
+        return;
+    }
+
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double logComplement = std::log(1.0 - probability);
+
+    uint64_t v = 1;
+    int64_t w = -1;
+    while (v < nodesCount)
+    {
+        auto skip = std::floor(std::log(1.0 - uniform(engine)) / logComplement);
+        w += 1 + static_cast<int64_t>(skip);
+        while (w >= static_cast<int64_t>(v) and v < nodesCount)
+        {
+            w -= static_cast<int64_t>(v);
+            v++;
+        }
+        if (v < nodesCount)
+        {
+            emit(static_cast<NodeId>(v), static_cast<NodeId>(w));
+        }
+    }
+}
+} // namespace
+
+PlantedColoring plantedColoring(const PlantedColoringParameters& parameters) {
+    const auto nodesCount = parameters.nodesCount;
+    const auto chromaticNumber = parameters.chromaticNumber;
+
+    if (chromaticNumber == 0 or nodesCount < chromaticNumber)
+    {
+        throw std::invalid_argument("Planted coloring requires at least k > 0 nodes");
+    }
+
+    std::mt19937_64 engine(parameters.seed);
+    auto partition = assignHiddenParts(nodesCount, chromaticNumber, engine);
+
+    std::vector<Pair> pairs;
+    sampleUniformPairs(nodesCount, parameters.interPartProbability, engine, [&pairs, &partition](NodeId v, NodeId w) {
+        if (partition[v] != partition[w])
+        {
+            pairs.emplace_back(w, v);
+        }
+    });
+
+    std::vector<NodeId> cliqueMembers(chromaticNumber, nodesCount);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        auto& member = cliqueMembers[partition[node]];
+        member = std::min(member, node);
+    }
+    for (uint32_t i = 0; i < chromaticNumber; i++)
+    {
+        for (uint32_t j = i + 1; j < chromaticNumber; j++)
+        {
+            pairs.emplace_back(std::minmax(cliqueMembers[i], cliqueMembers[j]));
+        }
+    }
+
+    std::ranges::sort(pairs);
+    auto duplicates = std::ranges::unique(pairs);
+    pairs.erase(duplicates.begin(), duplicates.end());
+
+    std::vector<EdgeInfo> edges;
+    edges.reserve(pairs.size() * 2);
+    for (const auto& [u, v] : pairs)
+    {
+        edges.push_back({u, v, std::nullopt});
+        edges.push_back({v, u, std::nullopt});
+    }
+
+    PlantedColoring result{CsrGraph(nodesCount, edges), std::move(partition)};
+    auto& metadata = result.graph.metadata();
+    metadata[chromaticNumberKey] = std::to_string(chromaticNumber);
+    metadata["generator"] = "planted_coloring";
+    metadata[symmetricKey] = "true";
+    metadata["inter_part_probability"] = std::to_string(parameters.interPartProbability);
+    metadata["seed"] = std::to_string(parameters.seed);
+    return result;
+}
+
+CsrGraph rmat(const RmatParameters& parameters) {
+    if (parameters.scale == 0 or parameters.scale > 31 or parameters.a + parameters.b + parameters.c > 1.0)
+    {
+        throw std::invalid_argument("R-MAT requires 0 < scale < 32 and a + b + c <= 1");
+    }
+
+    const auto nodesCount = 1u << parameters.scale;
+    const auto samplesCount = static_cast<uint64_t>(parameters.edgeFactor) * nodesCount;
+    std::mt19937_64 engine(parameters.seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    // without the scrambling low ids would be the hubs
+    std::vector<NodeId> scramble(nodesCount);
+    std::iota(scramble.begin(), scramble.end(), 0u);
+    std::shuffle(scramble.begin(), scramble.end(), engine);
+
+    std::vector<Pair> pairs;
+    pairs.reserve(samplesCount);
+    for (uint64_t i = 0; i < samplesCount; i++)
+    {
+        NodeId u = 0;
+        NodeId v = 0;
+        for (uint32_t level = 0; level < parameters.scale; level++)
+        {
+            auto sample = uniform(engine);
+            // quadrants a, b, c, d are top-left, top-right, bottom-left and bottom-right
+            auto lower = sample >= parameters.a + parameters.b;
+            auto right = lower ? sample >= parameters.a + parameters.b + parameters.c : sample >= parameters.a;
+            u = (u << 1) | (lower ? 1 : 0);
+            v = (v << 1) | (right ? 1 : 0);
+        }
+        if (u != v)
+        {
+            pairs.emplace_back(std::minmax(scramble[u], scramble[v]));
+        }
+    }
+
+    std::ranges::sort(pairs);
+    auto duplicates = std::ranges::unique(pairs);
+    pairs.erase(duplicates.begin(), duplicates.end());
+
+    std::vector<EdgeInfo> edges;
+    edges.reserve(pairs.size() * 2);
+    for (const auto& [u, v] : pairs)
+    {
+        edges.push_back({u, v, std::nullopt});
+        edges.push_back({v, u, std::nullopt});
+    }
+
+    CsrGraph graph(nodesCount, edges);
+    auto& metadata = graph.metadata();
+    metadata["generator"] = "rmat";
+    metadata[symmetricKey] = "true";
+    metadata["scale"] = std::to_string(parameters.scale);
+    metadata["edge_factor"] = std::to_string(parameters.edgeFactor);
+    metadata["seed"] = std::to_string(parameters.seed);
+    return graph;
+}
+
+std::optional<uint32_t> knownChromaticNumber(const CsrGraph& graph) {
+    auto entry = graph.metadata().find(chromaticNumberKey);
+    if (entry == graph.metadata().end())
+    {
+        return std::nullopt;
+    }
+    return static_cast<uint32_t>(std::stoul(entry->second));
+}
+} // namespace Graphs::Generators
@@ -0,0 +1,148 @@
+// this
+#include <Graphs/GraphMetrics.hpp>
+
+// libraries
+#include <algorithm>
+#include <cmath>
+#include <Graphs/LineGraph.hpp>
+#include <Graphs/Parallel.hpp>
+
+namespace Graphs::Metrics
+{
+namespace
+{
+constexpr std::size_t lanesCount = 8;
+constexpr std::size_t blockSize = 4096;
+constexpr uint64_t parallelThreshold = 1u << 16;
+
+/*
+        Independent float accumulators, so the per-edge loop can be
+        vectorized without reassociating a single sum. Blocks are short
+        enough to keep float rounding negligible before the lanes are
+        folded into double totals.
+*/
+struct Lanes
+{
+    float estrada[lanesCount] = {};
+    float randic[lanesCount] = {};
+    float atomBondConnectivity[lanesCount] = {};
+    uint64_t firstZagreb[lanesCount] = {};
+    uint64_t secondZagreb[lanesCount] = {};
+
+    void add(std::size_t lane, uint32_t lhsDegree, uint32_t rhsDegree) {
+        auto lhs = static_cast<float>(lhsDegree);
+        auto rhs = static_cast<float>(rhsDegree);
+        auto reducedSum = lhs + rhs - 2.0f;
+        auto product = lhs * rhs;
+
+        estrada[lane] += std::sqrt(reducedSum / (lhs * lhs)) + std::sqrt(reducedSum / (rhs * rhs));
+        randic[lane] += 1.0f / std::sqrt(product);
+        atomBondConnectivity[lane] += std::sqrt(reducedSum / product);
+        firstZagreb[lane] += static_cast<uint64_t>(lhsDegree) + rhsDegree;
+        secondZagreb[lane] += static_cast<uint64_t>(lhsDegree) * rhsDegree;
+    }
+
+    void foldInto(DegreeIndices& total) const {
+        for (std::size_t lane = 0; lane < lanesCount; lane++)
+        {
+            total.estrada += estrada[lane];
+            total.randic += randic[lane];
+            total.atomBondConnectivity += atomBondConnectivity[lane];
+            total.firstZagreb += firstZagreb[lane];
+            total.secondZagreb += secondZagreb[lane];
+        }
+    }
+};
+
+DegreeIndices accumulate(std::span<const EdgeIndex::Endpoints> edges, const std::vector<uint32_t>& degrees) {
+    DegreeIndices total;
+    for (std::size_t blockBegin = 0; blockBegin < edges.size(); blockBegin += blockSize)
+    {
+        const auto blockEnd = std::min(edges.size(), blockBegin + blockSize);
+        Lanes lanes;
+
+        auto i = blockBegin;
+        for (; i + lanesCount <= blockEnd; i += lanesCount)
+        {
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                const auto& [lower, higher] = edges[i + lane];
+                lanes.add(lane, degrees[lower], degrees[higher]);
+            }
+        }
+        for (; i < blockEnd; i++)
+        {
+            lanes.add(0, degrees[edges[i].first], degrees[edges[i].second]);
+        }
+
+        lanes.foldInto(total);
+    }
+    return total;
+}
+} // namespace
+
+DegreeIndices& operator+=(DegreeIndices& lhs, const DegreeIndices& rhs) {
+    lhs.estrada += rhs.estrada;
+    lhs.randic += rhs.randic;
+    lhs.firstZagreb += rhs.firstZagreb;
+    lhs.secondZagreb += rhs.secondZagreb;
+    lhs.atomBondConnectivity += rhs.atomBondConnectivity;
+    return lhs;
+}
+
+DegreeMetrics::DegreeMetrics(const Graph& graph, uint32_t threadsCount) : graph(graph), threadsCount(threadsCount) {}
+
+const DegreeIndices& DegreeMetrics::indices() {
+    refresh();
+    return cached;
+}
+
+std::span<const uint32_t> DegreeMetrics::degrees() {
+    refresh();
+    return degreeSequence;
+}
+
+void DegreeMetrics::refresh() {
+    if (computedRevision == graph.revision())
+    {
+        return;
+    }
+
+    const EdgeIndex index(graph);
+    const auto nodesCount = index.nodesAmount();
+
+    std::vector<uint32_t> denseDegrees(nodesCount);
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        denseDegrees[node] = static_cast<uint32_t>(index.incidentEdges(node).size());
+        maxNodeId = std::max(maxNodeId, index.originalId(node));
+    }
+
+    degreeSequence.assign(nodesCount == 0 ? 0 : static_cast<std::size_t>(maxNodeId) + 1, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        degreeSequence[index.originalId(node)] = denseDegrees[node];
+    }
+
+    auto edges = index.allEndpoints();
+    if (edges.size() < parallelThreshold)
+    {
+        cached = accumulate(edges, denseDegrees);
+    }
+    else
+    {
+        std::vector<DegreeIndices> partials(Parallel::resolveThreadsCount(threadsCount));
+        Parallel::forEachChunk(0, edges.size(), threadsCount, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+            partials[thread] = accumulate(edges.subspan(begin, end - begin), denseDegrees);
+        });
+
+        cached = {};
+        for (const auto& partial : partials)
+        {
+            cached += partial;
+        }
+    }
+    computedRevision = graph.revision();
+}
+} // namespace Graphs::Metrics
@@ -0,0 +1,185 @@
+// this
+#include <Graphs/GridGraph.hpp>
+
+// libraries
+#include <algorithm>
+#include <bit>
+#include <sstream>
+#include <stdexcept>
+
+namespace Graphs
+{
+namespace
+{
+constexpr uint64_t bitsPerWord = 64;
+
+uint32_t selectInWord(uint64_t word, uint32_t rank) {
+    for (uint32_t i = 0; i < rank; i++)
+    {
+        word &= word - 1;
+    }
+    return static_cast<uint32_t>(std::countr_zero(word));
+}
+} // namespace
+
+GridGraph::GridGraph(const Data::Pixel_map& pixelMap, Connectivity connectivity, Indexing indexing)
+    : map(pixelMap), mode(connectivity), indexing(indexing) {
+    const uint64_t pixels = static_cast<uint64_t>(map.get_rows()) * map.get_columns();
+    openBits.assign((pixels + bitsPerWord - 1) / bitsPerWord, 0);
+
+    uint64_t pixel = 0;
+    for (uint32_t row = 0; row < map.get_rows(); row++)
+    {
+        for (uint32_t column = 0; column < map.get_columns(); column++, pixel++)
+        {
+            if (map.get_field(row, column) == 0)
+            {
+                openBits[pixel / bitsPerWord] |= uint64_t{1} << (pixel % bitsPerWord);
+            }
+        }
+    }
+
+    blockRanks.resize(openBits.size());
+    for (std::size_t i = 0; i < openBits.size(); i++)
+    {
+        blockRanks[i] = openPixels;
+        openPixels += static_cast<uint32_t>(std::popcount(openBits[i]));
+    }
+}
+
+uint64_t GridGraph::rank(uint64_t pixel) const {
+    auto block = pixel / bitsPerWord;
+    auto lowerBits = openBits[block] & ((uint64_t{1} << (pixel % bitsPerWord)) - 1);
+    return blockRanks[block] + static_cast<uint64_t>(std::popcount(lowerBits));
+}
+
+uint64_t GridGraph::select(uint64_t rank) const {
+    auto block = std::ranges::upper_bound(blockRanks, static_cast<uint32_t>(rank)) - blockRanks.begin() - 1;
+    auto inWord = selectInWord(openBits[block], static_cast<uint32_t>(rank - blockRanks[block]));
+    return static_cast<uint64_t>(block) * bitsPerWord + inWord;
+}
+
+bool GridGraph::isOpenAt(int64_t row, int64_t column) const {
+    if (row < 0 or column < 0 or row >= map.get_rows() or column >= map.get_columns())
+    {
+        return false;
+    }
+    auto pixel = static_cast<uint64_t>(row) * map.get_columns() + static_cast<uint64_t>(column);
+    return (openBits[pixel / bitsPerWord] >> (pixel % bitsPerWord)) & 1;
+}
+
+bool GridGraph::isOpen(uint32_t row, uint32_t column) const {
+    return isOpenAt(row, column);
+}
+
+NodeId GridGraph::toNodeId(uint32_t row, uint32_t column) const {
+    auto pixel = static_cast<uint64_t>(row) * map.get_columns() + column;
+    return static_cast<NodeId>(indexing == Indexing::compact ? rank(pixel) : pixel);
+}
+
+Data::coord GridGraph::toCoord(NodeId node) const {
+    auto pixel = indexing == Indexing::compact ? select(node) : static_cast<uint64_t>(node);
+    return {static_cast<uint32_t>(pixel / map.get_columns()), static_cast<uint32_t>(pixel % map.get_columns())};
+}
+
+const Data::Pixel_map& GridGraph::pixelMap() const {
+    return map;
+}
+
+GridGraph::Connectivity GridGraph::connectivity() const {
+    return mode;
+}
+
+uint32_t GridGraph::nodesAmount() const {
+    return openPixels;
+}
+
+uint32_t GridGraph::nodeDegree(NodeId node) const {
+    if (node >= (indexing == Indexing::compact ? openPixels : static_cast<uint64_t>(map.get_rows()) * map.get_columns()))
+    {
+        return 0;
+    }
+    auto [row, column] = toCoord(node);
+    if (not isOpen(row, column))
+    {
+        return 0;
+    }
+
+    uint32_t degree = 0;
+    forEachNeighborPixel(row, column, [&degree](uint32_t, uint32_t) {
+        degree++;
+    });
+    return degree;
+}
+
+EdgeInfo GridGraph::findEdge(const EdgeInfo& edge) const {
+    if (nodeDegree(edge.source) == 0 or nodeDegree(edge.destination) == 0)
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    bool found = false;
+    forEachNeighbor(edge.source, [&found, &edge](NodeId neighbor) {
+        found = found or neighbor == edge.destination;
+    });
+    return {edge.source, edge.destination, found ? std::make_optional(1u) : std::nullopt};
+}
+
+void GridGraph::setEdge(const EdgeInfo&) {
+    throw std::logic_error("GridGraph is a read-only view");
+}
+
+void GridGraph::addNodes(uint32_t) {
+    throw std::logic_error("GridGraph is a read-only view");
+}
+
+void GridGraph::removeNode(NodeId) {
+    throw std::logic_error("GridGraph is a read-only view");
+}
+
+void GridGraph::removeEdge(const EdgeInfo&) {
+    throw std::logic_error("GridGraph is a read-only view");
+}
+
+std::vector<NodeId> GridGraph::getNodeIds() const {
+    std::vector<NodeId> nodeIds;
+    nodeIds.reserve(openPixels);
+    for (std::size_t i = 0; i < openBits.size(); i++)
+    {
+        for (auto word = openBits[i]; word != 0; word &= word - 1)
+        {
+            auto pixel = i * bitsPerWord + static_cast<uint64_t>(std::countr_zero(word));
+            nodeIds.push_back(static_cast<NodeId>(indexing == Indexing::compact ? nodeIds.size() : pixel));
+        }
+    }
+    return nodeIds;
+}
+
+std::vector<NodeId> GridGraph::getNeighborsOf(NodeId node) const {
+    std::vector<NodeId> neighbors;
+    if (nodeDegree(node) == 0)
+    {
+        return neighbors;
+    }
+    forEachNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    std::ranges::sort(neighbors);
+    return neighbors;
+}
+
+std::string GridGraph::show() const {
+    std::stringstream outStream;
+    outStream << "Nodes amount = " << nodesAmount() << "\n[\n";
+    for (uint32_t row = 0; row < map.get_rows(); row++)
+    {
+        for (uint32_t column = 0; column < map.get_columns(); column++)
+        {
+            outStream << (isOpen(row, column) ? '.' : '#');
+        }
+        outStream << "\n";
+    }
+    outStream << "]\n";
+    return outStream.str();
+}
+} // namespace Graphs
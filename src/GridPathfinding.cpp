@@ -0,0 +1,518 @@
+// this
+#include <Graphs/GridPathfinding.hpp>
+
+// libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+// 99 / 70 approximates sqrt(2) to 5 digits while keeping 43M steps in 32 bits
+constexpr uint32_t straightCost = 70;
+constexpr uint32_t diagonalCost = 99;
+
+constexpr uint32_t generationStep = 4;
+constexpr uint32_t openedMark = 1;
+constexpr uint32_t closedMark = 2;
+
+constexpr int64_t noJumpPoint = -1;
+
+int32_t sign(int64_t value) {
+    return static_cast<int32_t>((value > 0) - (value < 0));
+}
+
+bool isWorse(const auto& lhs, const auto& rhs) {
+    return lhs.estimate > rhs.estimate or (lhs.estimate == rhs.estimate and lhs.cost < rhs.cost);
+}
+
+uint32_t octileDistance(uint32_t rowDistance, uint32_t columnDistance) {
+    auto diagonalSteps = std::min(rowDistance, columnDistance);
+    auto straightSteps = std::max(rowDistance, columnDistance) - diagonalSteps;
+    return diagonalSteps * diagonalCost + straightSteps * straightCost;
+}
+
+uint32_t absoluteDifference(uint32_t lhs, uint32_t rhs) {
+    return lhs > rhs ? lhs - rhs : rhs - lhs;
+}
+} // namespace
+
+GridPathfinder::GridPathfinder(const Data::Pixel_map& map, GridGraph::Connectivity connectivity)
+    : grid(map, connectivity), rows(map.get_rows()), columns(map.get_columns()) {
+    const auto pixels = static_cast<std::size_t>(rows) * columns;
+    marks.assign(pixels, 0);
+    costs.resize(pixels);
+    parents.resize(pixels);
+}
+
+bool GridPathfinder::isOpen(int64_t row, int64_t column) const {
+    return row >= 0 and column >= 0 and row < rows and column < columns
+       and grid.isOpen(static_cast<uint32_t>(row), static_cast<uint32_t>(column));
+}
+
+uint32_t GridPathfinder::toPixel(uint32_t row, uint32_t column) const {
+    return row * columns + column;
+}
+
+uint32_t GridPathfinder::beginQuery(Data::coord start, Data::coord goal, GridPath& result) {
+    if (start.x >= rows or start.y >= columns or goal.x >= rows or goal.y >= columns)
+    {
+        throw std::out_of_range("Query pixel outside of the map");
+    }
+
+    result.found = false;
+    result.length = 0.0;
+    result.expandedNodes = 0;
+    result.pixels.clear();
+
+    // marks of earlier queries become stale once the generation moves on,
+    // so they are cleared only when the counter wraps around
+    if (generation > std::numeric_limits<uint32_t>::max() - generationStep)
+    {
+        std::ranges::fill(marks, 0);
+        generation = 0;
+    }
+    generation += generationStep;
+    return generation;
+}
+
+uint32_t GridPathfinder::heuristic(uint32_t pixel, uint32_t goal, Heuristic kind) const {
+    auto rowDistance = absoluteDifference(pixel / columns, goal / columns);
+    auto columnDistance = absoluteDifference(pixel % columns, goal % columns);
+
+    if (kind == Heuristic::octile)
+    {
+        return octileDistance(rowDistance, columnDistance);
+    }
+    return (rowDistance + columnDistance) * straightCost;
+}
+
+void GridPathfinder::pushOpen(uint32_t pixel, uint32_t cost, uint32_t estimate) {
+    openList.push_back({estimate, cost, pixel});
+    std::push_heap(openList.begin(), openList.end(), [](const auto& lhs, const auto& rhs) {
+        return isWorse(lhs, rhs);
+    });
+}
+
+void GridPathfinder::appendSegment(uint32_t from, uint32_t to, GridPath& result) const {
+    int64_t row = from / columns;
+    int64_t column = from % columns;
+    const int64_t targetRow = to / columns;
+    const int64_t targetColumn = to % columns;
+
+    const auto rowStep = sign(targetRow - row);
+    const auto columnStep = sign(targetColumn - column);
+    const auto stepLength = rowStep != 0 and columnStep != 0 ? std::sqrt(2.0) : 1.0;
+
+    while (row != targetRow or column != targetColumn)
+    {
+        row += rowStep;
+        column += columnStep;
+        result.pixels.push_back({static_cast<uint32_t>(row), static_cast<uint32_t>(column)});
+        result.length += stepLength;
+    }
+}
+
+/*
+        Follows parents from both ends of the path. Searches starting from
+        one end pass the same pixel twice, bidirectional search passes the
+        two pixels where the frontiers met. Jump Point Search parents can
+        lie further than one step away, the gaps are filled by appendSegment.
+*/
+void GridPathfinder::reconstructPath(uint32_t forwardEnd, uint32_t backwardEnd, GridPath& result) {
+    result.found = true;
+
+    waypoints.clear();
+    for (auto pixel = forwardEnd;; pixel = parents[pixel])
+    {
+        waypoints.push_back(pixel);
+        if (parents[pixel] == pixel)
+        {
+            break;
+        }
+    }
+
+    result.pixels.push_back({waypoints.back() / columns, waypoints.back() % columns});
+    for (auto i = waypoints.size() - 1; i > 0; i--)
+    {
+        appendSegment(waypoints[i], waypoints[i - 1], result);
+    }
+
+    if (backwardEnd == forwardEnd)
+    {
+        return;
+    }
+    appendSegment(forwardEnd, backwardEnd, result);
+    for (auto pixel = backwardEnd; parents[pixel] != pixel; pixel = parents[pixel])
+    {
+        appendSegment(pixel, parents[pixel], result);
+    }
+}
+
+/*
+        Bidirectional breadth first search, minimizing the amount of steps.
+        Every round expands one whole level of the smaller frontier, and the
+        search stops at the end of the first level in which frontiers meet.
+*/
+bool GridPathfinder::breadthFirst(Data::coord start, Data::coord goal, GridPath& result) {
+    const auto base = beginQuery(start, goal, result);
+    const auto source = toPixel(start.x, start.y);
+    const auto target = toPixel(goal.x, goal.y);
+
+    if (not isOpen(start.x, start.y) or not isOpen(goal.x, goal.y))
+    {
+        return false;
+    }
+
+    marks[source] = base + openedMark;
+    costs[source] = 0;
+    parents[source] = source;
+    forwardFrontier.assign(1, source);
+
+    if (source == target)
+    {
+        reconstructPath(source, source, result);
+        return true;
+    }
+
+    marks[target] = base + closedMark;
+    costs[target] = 0;
+    parents[target] = target;
+    backwardFrontier.assign(1, target);
+
+    auto bestLength = std::numeric_limits<uint32_t>::max();
+    uint32_t forwardMeeting = source;
+    uint32_t backwardMeeting = target;
+
+    while (not forwardFrontier.empty() and not backwardFrontier.empty())
+    {
+        const bool forward = forwardFrontier.size() <= backwardFrontier.size();
+        auto& frontier = forward ? forwardFrontier : backwardFrontier;
+        const auto ownMark = base + (forward ? openedMark : closedMark);
+        const auto otherMark = base + (forward ? closedMark : openedMark);
+
+        nextFrontier.clear();
+        for (auto pixel : frontier)
+        {
+            result.expandedNodes++;
+            grid.forEachNeighborPixel(pixel / columns, pixel % columns, [&](uint32_t row, uint32_t column) {
+                auto neighbor = toPixel(row, column);
+                if (marks[neighbor] == otherMark)
+                {
+                    auto length = costs[pixel] + 1 + costs[neighbor];
+                    if (length < bestLength)
+                    {
+                        bestLength = length;
+                        forwardMeeting = forward ? pixel : neighbor;
+                        backwardMeeting = forward ? neighbor : pixel;
+                    }
+                }
+                else if (marks[neighbor] != ownMark)
+                {
+                    marks[neighbor] = ownMark;
+                    costs[neighbor] = costs[pixel] + 1;
+                    parents[neighbor] = pixel;
+                    nextFrontier.push_back(neighbor);
+                }
+            });
+        }
+
+        if (bestLength != std::numeric_limits<uint32_t>::max())
+        {
+            reconstructPath(forwardMeeting, backwardMeeting, result);
+            return true;
+        }
+        std::swap(frontier, nextFrontier);
+    }
+    return false;
+}
+
+bool GridPathfinder::aStar(Data::coord start, Data::coord goal, GridPath& result) {
+    auto kind = grid.connectivity() == GridGraph::Connectivity::eight ? Heuristic::octile : Heuristic::manhattan;
+    return aStar(start, goal, kind, result);
+}
+
+/*
+        A* search. Both heuristics are consistent for their own connectivity,
+        so closed pixels are never reopened. Manhattan distance overestimates
+        on eight-connected grids, which trades optimality for speed.
+*/
+bool GridPathfinder::aStar(Data::coord start, Data::coord goal, Heuristic kind, GridPath& result) {
+    const auto base = beginQuery(start, goal, result);
+    const auto source = toPixel(start.x, start.y);
+    const auto target = toPixel(goal.x, goal.y);
+
+    if (not isOpen(start.x, start.y) or not isOpen(goal.x, goal.y))
+    {
+        return false;
+    }
+
+    openList.clear();
+    marks[source] = base + openedMark;
+    costs[source] = 0;
+    parents[source] = source;
+    pushOpen(source, 0, heuristic(source, target, kind));
+
+    while (not openList.empty())
+    {
+        std::pop_heap(openList.begin(), openList.end(), [](const auto& lhs, const auto& rhs) {
+            return isWorse(lhs, rhs);
+        });
+        auto [estimate, cost, pixel] = openList.back();
+        openList.pop_back();
+
+        if (marks[pixel] == base + closedMark or cost > costs[pixel])
+        {
+            continue;
+        }
+        marks[pixel] = base + closedMark;
+        result.expandedNodes++;
+
+        if (pixel == target)
+        {
+            reconstructPath(target, target, result);
+            return true;
+        }
+
+        const auto row = pixel / columns;
+        const auto column = pixel % columns;
+        grid.forEachNeighborPixel(row, column, [&](uint32_t neighborRow, uint32_t neighborColumn) {
+            auto neighbor = toPixel(neighborRow, neighborColumn);
+            auto step = neighborRow != row and neighborColumn != column ? diagonalCost : straightCost;
+            auto neighborCost = cost + step;
+
+            if (marks[neighbor] == base + closedMark)
+            {
+                return;
+            }
+            if (marks[neighbor] != base + openedMark or neighborCost < costs[neighbor])
+            {
+                marks[neighbor] = base + openedMark;
+                costs[neighbor] = neighborCost;
+                parents[neighbor] = pixel;
+                pushOpen(neighbor, neighborCost, neighborCost + heuristic(neighbor, target, kind));
+            }
+        });
+    }
+    return false;
+}
+
+int64_t GridPathfinder::jumpStraight(int64_t row, int64_t column, int32_t rowStep, int32_t columnStep, uint32_t goal) const {
+    while (isOpen(row, column))
+    {
+        auto pixel = toPixel(static_cast<uint32_t>(row), static_cast<uint32_t>(column));
+        if (pixel == goal)
+        {
+            return pixel;
+        }
+
+        // a side pixel that was blocked one step back is reachable only through this pixel
+        bool forced = rowStep != 0 ? (isOpen(row, column - 1) and not isOpen(row - rowStep, column - 1))
+                                         or (isOpen(row, column + 1) and not isOpen(row - rowStep, column + 1))
+                                   : (isOpen(row - 1, column) and not isOpen(row - 1, column - columnStep))
+                                         or (isOpen(row + 1, column) and not isOpen(row + 1, column - columnStep));
+        if (forced)
+        {
+            return pixel;
+        }
+        row += rowStep;
+        column += columnStep;
+    }
+    return noJumpPoint;
+}
+
+int64_t GridPathfinder::jump(int64_t row, int64_t column, int32_t rowStep, int32_t columnStep, uint32_t goal) const {
+    if (rowStep == 0 or columnStep == 0)
+    {
+        return jumpStraight(row, column, rowStep, columnStep, goal);
+    }
+
+    while (isOpen(row, column))
+    {
+        auto pixel = toPixel(static_cast<uint32_t>(row), static_cast<uint32_t>(column));
+        if (pixel == goal or jumpStraight(row + rowStep, column, rowStep, 0, goal) != noJumpPoint
+            or jumpStraight(row, column + columnStep, 0, columnStep, goal) != noJumpPoint)
+        {
+            return pixel;
+        }
+        if (not isOpen(row + rowStep, column) or not isOpen(row, column + columnStep))
+        {
+            break;
+        }
+        row += rowStep;
+        column += columnStep;
+    }
+    return noJumpPoint;
+}
+
+/*
+        Jump Point Search (Harabor & Grastien) for eight-connected grids
+        where diagonal moves may not cut wall corners. Only the jump points
+        enter the open list, the returned path is expanded to all pixels.
+*/
+bool GridPathfinder::jumpPoint(Data::coord start, Data::coord goal, GridPath& result) {
+    if (grid.connectivity() != GridGraph::Connectivity::eight)
+    {
+        throw std::invalid_argument("Jump Point Search requires an eight-connected grid");
+    }
+
+    const auto base = beginQuery(start, goal, result);
+    const auto source = toPixel(start.x, start.y);
+    const auto target = toPixel(goal.x, goal.y);
+
+    if (not isOpen(start.x, start.y) or not isOpen(goal.x, goal.y))
+    {
+        return false;
+    }
+
+    openList.clear();
+    marks[source] = base + openedMark;
+    costs[source] = 0;
+    parents[source] = source;
+    pushOpen(source, 0, heuristic(source, target, Heuristic::octile));
+
+    std::array<std::pair<int32_t, int32_t>, 8> directions;
+    while (not openList.empty())
+    {
+        std::pop_heap(openList.begin(), openList.end(), [](const auto& lhs, const auto& rhs) {
+            return isWorse(lhs, rhs);
+        });
+        auto [estimate, cost, pixel] = openList.back();
+        openList.pop_back();
+
+        if (marks[pixel] == base + closedMark or cost > costs[pixel])
+        {
+            continue;
+        }
+        marks[pixel] = base + closedMark;
+        result.expandedNodes++;
+
+        if (pixel == target)
+        {
+            reconstructPath(target, target, result);
+            return true;
+        }
+
+        const int64_t row = pixel / columns;
+        const int64_t column = pixel % columns;
+        std::size_t directionsCount = 0;
+        auto addDirection = [&directions, &directionsCount](int32_t rowStep, int32_t columnStep) {
+            directions[directionsCount++] = {rowStep, columnStep};
+        };
+
+        if (parents[pixel] == pixel)
+        {
+            grid.forEachNeighborPixel(static_cast<uint32_t>(row), static_cast<uint32_t>(column), [&](uint32_t r, uint32_t c) {
+                addDirection(sign(r - row), sign(c - column));
+            });
+        }
+        else
+        {
+            const auto rowStep = sign(row - static_cast<int64_t>(parents[pixel] / columns));
+            const auto columnStep = sign(column - static_cast<int64_t>(parents[pixel] % columns));
+
+            if (rowStep != 0 and columnStep != 0)
+            {
+                bool vertical = isOpen(row + rowStep, column);
+                bool horizontal = isOpen(row, column + columnStep);
+                if (vertical)
+                {
+                    addDirection(rowStep, 0);
+                }
+                if (horizontal)
+                {
+                    addDirection(0, columnStep);
+                }
+                if (vertical and horizontal)
+                {
+                    addDirection(rowStep, columnStep);
+                }
+            }
+            else if (rowStep != 0)
+            {
+                bool next = isOpen(row + rowStep, column);
+                bool left = isOpen(row, column - 1);
+                bool right = isOpen(row, column + 1);
+                if (next)
+                {
+                    addDirection(rowStep, 0);
+                    if (left)
+                    {
+                        addDirection(rowStep, -1);
+                    }
+                    if (right)
+                    {
+                        addDirection(rowStep, 1);
+                    }
+                }
+                if (left)
+                {
+                    addDirection(0, -1);
+                }
+                if (right)
+                {
+                    addDirection(0, 1);
+                }
+            }
+            else
+            {
+                bool next = isOpen(row, column + columnStep);
+                bool up = isOpen(row - 1, column);
+                bool down = isOpen(row + 1, column);
+                if (next)
+                {
+                    addDirection(0, columnStep);
+                    if (up)
+                    {
+                        addDirection(-1, columnStep);
+                    }
+                    if (down)
+                    {
+                        addDirection(1, columnStep);
+                    }
+                }
+                if (up)
+                {
+                    addDirection(-1, 0);
+                }
+                if (down)
+                {
+                    addDirection(1, 0);
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < directionsCount; i++)
+        {
+            auto [rowStep, columnStep] = directions[i];
+            auto jumpPixel = jump(row + rowStep, column + columnStep, rowStep, columnStep, target);
+            if (jumpPixel == noJumpPoint)
+            {
+                continue;
+            }
+
+            auto successor = static_cast<uint32_t>(jumpPixel);
+            if (marks[successor] == base + closedMark)
+            {
+                continue;
+            }
+
+            auto distance = octileDistance(absoluteDifference(successor / columns, static_cast<uint32_t>(row)),
+                                           absoluteDifference(successor % columns, static_cast<uint32_t>(column)));
+            auto successorCost = cost + distance;
+            if (marks[successor] != base + openedMark or successorCost < costs[successor])
+            {
+                marks[successor] = base + openedMark;
+                costs[successor] = successorCost;
+                parents[successor] = pixel;
+                pushOpen(successor, successorCost, successorCost + heuristic(successor, target, Heuristic::octile));
+            }
+        }
+    }
+    return false;
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,170 @@
+// this
+#include <Graphs/LineGraph.hpp>
+
+// libraries
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace Graphs
+{
+EdgeIndex::EdgeIndex(const Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+
+    // bucket every arc by its lower endpoint, so both directions meet in one bucket
+    std::vector<uint64_t> bucketOffsets(nodesCount + 1, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        for (auto neighbor : csrGraph.neighbors(node))
+        {
+            if (neighbor != node)
+            {
+                bucketOffsets[std::min(node, neighbor) + 1]++;
+            }
+        }
+    }
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        bucketOffsets[node + 1] += bucketOffsets[node];
+    }
+
+    std::vector<NodeId> higherEndpoints(bucketOffsets.back());
+    std::vector<uint64_t> cursor(bucketOffsets.begin(), bucketOffsets.end() - 1);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        for (auto neighbor : csrGraph.neighbors(node))
+        {
+            if (neighbor != node)
+            {
+                higherEndpoints[cursor[std::min(node, neighbor)]++] = std::max(node, neighbor);
+            }
+        }
+    }
+
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        auto first = higherEndpoints.begin() + static_cast<std::ptrdiff_t>(bucketOffsets[node]);
+        auto last = higherEndpoints.begin() + static_cast<std::ptrdiff_t>(bucketOffsets[node + 1]);
+        std::sort(first, last);
+        last = std::unique(first, last);
+        for (auto itr = first; itr != last; itr++)
+        {
+            edgeEndpoints.emplace_back(node, *itr);
+        }
+    }
+
+    if (edgeEndpoints.size() >= std::numeric_limits<EdgeId>::max())
+    {
+        throw std::length_error("Too many edges for 32-bit edge ids");
+    }
+
+    incidenceOffsets.assign(nodesCount + 1, 0);
+    for (const auto& [lower, higher] : edgeEndpoints)
+    {
+        incidenceOffsets[lower + 1]++;
+        incidenceOffsets[higher + 1]++;
+    }
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        incidenceOffsets[node + 1] += incidenceOffsets[node];
+    }
+
+    // filling in edge id order keeps every incidence list sorted
+    incidence.resize(incidenceOffsets.back());
+    cursor.assign(incidenceOffsets.begin(), incidenceOffsets.end() - 1);
+    for (EdgeId edge = 0; edge < edgeEndpoints.size(); edge++)
+    {
+        incidence[cursor[edgeEndpoints[edge].first]++] = edge;
+        incidence[cursor[edgeEndpoints[edge].second]++] = edge;
+    }
+
+    originalIds.resize(nodesCount);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        originalIds[node] = csrGraph.originalId(node);
+    }
+}
+
+uint32_t EdgeIndex::nodesAmount() const {
+    return static_cast<uint32_t>(incidenceOffsets.size() - 1);
+}
+
+uint32_t EdgeIndex::edgesAmount() const {
+    return static_cast<uint32_t>(edgeEndpoints.size());
+}
+
+uint32_t EdgeIndex::maxDegree() const {
+    uint64_t degree = 0;
+    for (NodeId node = 0; node < nodesAmount(); node++)
+    {
+        degree = std::max(degree, incidenceOffsets[node + 1] - incidenceOffsets[node]);
+    }
+    return static_cast<uint32_t>(degree);
+}
+
+EdgeIndex::Endpoints EdgeIndex::endpoints(EdgeId edge) const {
+    return edgeEndpoints[edge];
+}
+
+std::span<const EdgeIndex::Endpoints> EdgeIndex::allEndpoints() const {
+    return edgeEndpoints;
+}
+
+std::span<const EdgeId> EdgeIndex::incidentEdges(NodeId node) const {
+    return {incidence.data() + incidenceOffsets[node], incidence.data() + incidenceOffsets[node + 1]};
+}
+
+NodeId EdgeIndex::originalId(NodeId node) const {
+    return originalIds[node];
+}
+
+std::size_t EdgeIndex::memoryUsage() const {
+    return edgeEndpoints.capacity() * sizeof(Endpoints) + incidenceOffsets.capacity() * sizeof(uint64_t)
+         + incidence.capacity() * sizeof(EdgeId) + originalIds.capacity() * sizeof(NodeId);
+}
+
+CsrGraph makeLineGraph(const EdgeIndex& index) {
+    const auto edgesCount = index.edgesAmount();
+
+    std::pmr::vector<CsrGraph::Offset> offsets(edgesCount + 1, 0);
+    for (EdgeId edge = 0; edge < edgesCount; edge++)
+    {
+        auto [lower, higher] = index.endpoints(edge);
+        offsets[edge + 1] = offsets[edge] + index.incidentEdges(lower).size() + index.incidentEdges(higher).size() - 2;
+    }
+
+    // in a simple graph the two incidence lists share only the edge itself,
+    // so merging them yields a sorted row without duplicates
+    std::pmr::vector<NodeId> adjacency(offsets.back());
+    for (EdgeId edge = 0; edge < edgesCount; edge++)
+    {
+        auto [lower, higher] = index.endpoints(edge);
+        auto lowerEdges = index.incidentEdges(lower);
+        auto higherEdges = index.incidentEdges(higher);
+
+        auto output = adjacency.begin() + static_cast<std::ptrdiff_t>(offsets[edge]);
+        auto lowerItr = lowerEdges.begin();
+        auto higherItr = higherEdges.begin();
+        while (lowerItr != lowerEdges.end() or higherItr != higherEdges.end())
+        {
+            bool takeLower = higherItr == higherEdges.end() or (lowerItr != lowerEdges.end() and *lowerItr < *higherItr);
+            auto neighbor = takeLower ? *lowerItr++ : *higherItr++;
+            if (neighbor != edge)
+            {
+                *output++ = neighbor;
+            }
+        }
+    }
+
+    return CsrGraph(std::move(offsets), std::move(adjacency));
+}
+
+LineGraph makeLineGraph(const Graph& graph) {
+    EdgeIndex index(graph);
+    auto lineGraph = makeLineGraph(index);
+    return LineGraph{std::move(index), std::move(lineGraph)};
+}
+} // namespace Graphs
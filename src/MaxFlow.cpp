@@ -0,0 +1,435 @@
+// this
+#include <Graphs/MaxFlow.hpp>
+
+// libraries
+#include <algorithm>
+#include <deque>
+#include <Graphs/CsrGraph.hpp>
+#include <limits>
+#include <optional>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+constexpr uint64_t noArc = std::numeric_limits<uint64_t>::max();
+
+/*
+        Every edge becomes a forward arc carrying its capacity and a reverse
+        arc starting empty, stored next to the other arcs of their tails.
+        Pushing along an arc moves capacity to its mate, so the two always
+        sum up to the capacity of the edge.
+*/
+struct Residual
+{
+    std::vector<uint64_t> offsets;
+    std::vector<NodeId> heads;
+    std::vector<uint64_t> mates;
+    std::vector<uint32_t> capacities;
+    std::vector<uint64_t> forwardArcs;
+
+    NodeId tail(uint64_t arc) const {
+        return heads[mates[arc]];
+    }
+
+    void push(uint64_t arc, uint32_t amount) {
+        capacities[arc] -= amount;
+        capacities[mates[arc]] += amount;
+    }
+};
+
+uint32_t capacityOf(const CsrGraph& graph, NodeId node, std::size_t position) {
+    return graph.isWeighted() ? graph.weights(node)[position] : 1;
+}
+
+Residual buildResidual(const CsrGraph& graph) {
+    const auto nodesCount = graph.nodesAmount();
+    Residual residual;
+    residual.offsets.assign(static_cast<std::size_t>(nodesCount) + 1, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        for (auto neighbor : graph.neighbors(node))
+        {
+            // self-loops can never carry flow between different nodes
+            if (neighbor != node)
+            {
+                residual.offsets[node + 1]++;
+                residual.offsets[neighbor + 1]++;
+            }
+        }
+    }
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        residual.offsets[node + 1] += residual.offsets[node];
+    }
+
+    const auto arcsCount = residual.offsets.back();
+    residual.heads.resize(arcsCount);
+    residual.mates.resize(arcsCount);
+    residual.capacities.resize(arcsCount);
+    residual.forwardArcs.reserve(graph.edgesAmount());
+
+    std::vector<uint64_t> cursors(residual.offsets.begin(), residual.offsets.end() - 1);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        auto neighbors = graph.neighbors(node);
+        for (std::size_t i = 0; i < neighbors.size(); i++)
+        {
+            auto neighbor = neighbors[i];
+            if (neighbor == node)
+            {
+                residual.forwardArcs.push_back(noArc);
+                continue;
+            }
+            auto forward = cursors[node]++;
+            auto reverse = cursors[neighbor]++;
+            residual.heads[forward] = neighbor;
+            residual.heads[reverse] = node;
+            residual.mates[forward] = reverse;
+            residual.mates[reverse] = forward;
+            residual.capacities[forward] = capacityOf(graph, node, i);
+            residual.capacities[reverse] = 0;
+            residual.forwardArcs.push_back(forward);
+        }
+    }
+    return residual;
+}
+
+/*
+        FIFO push-relabel. Labels below nodesCount estimate the distance to
+        the sink, labels above it the distance back to the source plus
+        nodesCount, so the excess that cannot reach the sink returns to the
+        source and the final preflow is a flow.
+*/
+class PushRelabel
+{
+    public:
+    PushRelabel(Residual& residual, NodeId source, NodeId sink)
+        : residual(residual), nodesCount(static_cast<NodeId>(residual.offsets.size() - 1)), source(source), sink(sink),
+          excess(nodesCount, 0), labels(nodesCount, 0), current(residual.offsets.begin(), residual.offsets.end() - 1),
+          labelCounts(2 * static_cast<std::size_t>(nodesCount) + 1, 0), queued(nodesCount, false) {}
+
+    uint64_t run() {
+        for (auto arc = residual.offsets[source]; arc < residual.offsets[source + 1]; arc++)
+        {
+            auto amount = residual.capacities[arc];
+            residual.push(arc, amount);
+            excess[residual.heads[arc]] += amount;
+        }
+        globalRelabel();
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            activate(node);
+        }
+
+        const auto relabelThreshold = 6 * static_cast<uint64_t>(nodesCount) + residual.heads.size();
+        while (not active.empty())
+        {
+            auto node = active.front();
+            active.pop_front();
+            queued[node] = false;
+
+            if (work > relabelThreshold)
+            {
+                globalRelabel();
+                work = 0;
+            }
+            discharge(node);
+        }
+        return excess[sink];
+    }
+
+    private:
+    NodeId unlabeled() const {
+        return 2 * nodesCount;
+    }
+
+    void activate(NodeId node) {
+        if (not queued[node] and excess[node] > 0 and node != source and node != sink and labels[node] < unlabeled())
+        {
+            queued[node] = true;
+            active.push_back(node);
+        }
+    }
+
+    void setLabel(NodeId node, NodeId label) {
+        labelCounts[labels[node]]--;
+        labels[node] = label;
+        labelCounts[label]++;
+    }
+
+    /* Exact labels from backward BFS over the residual arcs, first from the sink, then from the source */
+    void globalRelabel() {
+        std::ranges::fill(labels, unlabeled());
+        std::ranges::fill(labelCounts, 0);
+        labels[sink] = 0;
+        labels[source] = nodesCount;
+
+        std::vector<NodeId> queue;
+        queue.reserve(nodesCount);
+        for (auto root : {sink, source})
+        {
+            queue.assign(1, root);
+            for (std::size_t head = 0; head < queue.size(); head++)
+            {
+                auto node = queue[head];
+                for (auto arc = residual.offsets[node]; arc < residual.offsets[node + 1]; arc++)
+                {
+                    auto neighbor = residual.heads[arc];
+                    if (labels[neighbor] == unlabeled() and residual.capacities[residual.mates[arc]] > 0)
+                    {
+                        labels[neighbor] = labels[node] + 1;
+                        queue.push_back(neighbor);
+                    }
+                }
+            }
+        }
+
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            labelCounts[labels[node]]++;
+            current[node] = residual.offsets[node];
+        }
+    }
+
+    /* Nodes above an emptied label below nodesCount are cut off from the sink */
+    void gap(NodeId emptied) {
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            if (labels[node] > emptied and labels[node] < nodesCount)
+            {
+                setLabel(node, nodesCount + 1);
+                current[node] = residual.offsets[node];
+            }
+        }
+    }
+
+    void relabel(NodeId node) {
+        NodeId label = unlabeled();
+        for (auto arc = residual.offsets[node]; arc < residual.offsets[node + 1]; arc++)
+        {
+            if (residual.capacities[arc] > 0)
+            {
+                label = std::min(label, labels[residual.heads[arc]] + 1);
+            }
+        }
+        work += residual.offsets[node + 1] - residual.offsets[node] + 12;
+
+        auto previous = labels[node];
+        setLabel(node, label);
+        current[node] = residual.offsets[node];
+        if (previous < nodesCount and labelCounts[previous] == 0)
+        {
+            gap(previous);
+        }
+    }
+
+    void discharge(NodeId node) {
+        while (excess[node] > 0 and labels[node] < unlabeled())
+        {
+            auto& arc = current[node];
+            if (arc == residual.offsets[node + 1])
+            {
+                relabel(node);
+                continue;
+            }
+
+            auto neighbor = residual.heads[arc];
+            if (residual.capacities[arc] > 0 and labels[node] == labels[neighbor] + 1)
+            {
+                auto amount = static_cast<uint32_t>(std::min<uint64_t>(excess[node], residual.capacities[arc]));
+                residual.push(arc, amount);
+                excess[node] -= amount;
+                excess[neighbor] += amount;
+                activate(neighbor);
+            }
+            else
+            {
+                arc++;
+            }
+        }
+    }
+
+    Residual& residual;
+    NodeId nodesCount;
+    NodeId source;
+    NodeId sink;
+    std::vector<uint64_t> excess;
+    std::vector<NodeId> labels;
+    std::vector<uint64_t> current;
+    std::vector<uint32_t> labelCounts;
+    std::vector<bool> queued;
+    std::deque<NodeId> active;
+    uint64_t work = 0;
+};
+
+constexpr uint32_t unreached = std::numeric_limits<uint32_t>::max();
+
+bool levelGraph(const Residual& residual, NodeId source, NodeId sink, std::vector<uint32_t>& levels, std::vector<NodeId>& queue) {
+    std::ranges::fill(levels, unreached);
+    levels[source] = 0;
+    queue.assign(1, source);
+    for (std::size_t head = 0; head < queue.size() and levels[sink] == unreached; head++)
+    {
+        auto node = queue[head];
+        for (auto arc = residual.offsets[node]; arc < residual.offsets[node + 1]; arc++)
+        {
+            auto neighbor = residual.heads[arc];
+            if (levels[neighbor] == unreached and residual.capacities[arc] > 0)
+            {
+                levels[neighbor] = levels[node] + 1;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+    return levels[sink] != unreached;
+}
+
+/*
+        Blocking flow by DFS along current arcs, kept on an explicit path so
+        long level graphs cannot overflow the call stack. Dead ends leave the
+        level graph, augmentations retreat to the first saturated arc.
+*/
+uint64_t blockingFlow(Residual& residual, NodeId source, NodeId sink, std::vector<uint32_t>& levels) {
+    std::vector<uint64_t> current(residual.offsets.begin(), residual.offsets.end() - 1);
+    std::vector<uint64_t> path;
+    uint64_t total = 0;
+
+    auto node = source;
+    while (true)
+    {
+        if (node == sink)
+        {
+            auto amount = residual.capacities[path.front()];
+            for (auto arc : path)
+            {
+                amount = std::min(amount, residual.capacities[arc]);
+            }
+            std::size_t saturated = path.size();
+            for (std::size_t i = 0; i < path.size(); i++)
+            {
+                residual.push(path[i], amount);
+                if (residual.capacities[path[i]] == 0 and saturated == path.size())
+                {
+                    saturated = i;
+                }
+            }
+            total += amount;
+            node = residual.tail(path[saturated]);
+            path.resize(saturated);
+            continue;
+        }
+
+        auto& arc = current[node];
+        const auto end = residual.offsets[node + 1];
+        while (arc < end and (residual.capacities[arc] == 0 or levels[residual.heads[arc]] != levels[node] + 1))
+        {
+            arc++;
+        }
+        if (arc < end)
+        {
+            path.push_back(arc);
+            node = residual.heads[arc];
+            continue;
+        }
+
+        if (node == source)
+        {
+            return total;
+        }
+        levels[node] = unreached;
+        node = residual.tail(path.back());
+        path.pop_back();
+        current[node]++;
+    }
+}
+
+uint64_t dinic(Residual& residual, NodeId source, NodeId sink) {
+    const auto nodesCount = residual.offsets.size() - 1;
+    std::vector<uint32_t> levels(nodesCount);
+    std::vector<NodeId> queue;
+    queue.reserve(nodesCount);
+
+    uint64_t total = 0;
+    while (levelGraph(residual, source, sink, levels, queue))
+    {
+        total += blockingFlow(residual, source, sink, levels);
+    }
+    return total;
+}
+} // namespace
+
+void MaxFlow::operator()(const Graphs::Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+
+    NodeId from = nodesCount;
+    NodeId to = nodesCount;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        from = csrGraph.originalId(node) == source ? node : from;
+        to = csrGraph.originalId(node) == sink ? node : to;
+    }
+    if (from == nodesCount or to == nodesCount)
+    {
+        throw std::out_of_range("Flow source or sink is not a node of the graph");
+    }
+
+    auto residual = buildResidual(csrGraph);
+    if (method == Method::pushRelabel)
+    {
+        result->value = PushRelabel(residual, from, to).run();
+    }
+    else
+    {
+        result->value = dinic(residual, from, to);
+    }
+
+    // after a maximum flow the sink is out of reach, so the reachable nodes form a minimum cut
+    std::vector<bool> reachable(nodesCount, false);
+    std::vector<NodeId> queue = {from};
+    reachable[from] = true;
+    for (std::size_t head = 0; head < queue.size(); head++)
+    {
+        auto node = queue[head];
+        for (auto arc = residual.offsets[node]; arc < residual.offsets[node + 1]; arc++)
+        {
+            auto neighbor = residual.heads[arc];
+            if (not reachable[neighbor] and residual.capacities[arc] > 0)
+            {
+                reachable[neighbor] = true;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+
+    result->edgeFlows.clear();
+    result->edgeFlows.reserve(csrGraph.edgesAmount());
+    result->cutEdges.clear();
+    result->sourceSide.clear();
+    std::size_t edge = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        if (reachable[node])
+        {
+            result->sourceSide.push_back(csrGraph.originalId(node));
+        }
+
+        auto neighbors = csrGraph.neighbors(node);
+        for (std::size_t i = 0; i < neighbors.size(); i++, edge++)
+        {
+            auto capacity = capacityOf(csrGraph, node, i);
+            auto arc = residual.forwardArcs[edge];
+            EdgeFlow edgeFlow{csrGraph.originalId(node), csrGraph.originalId(neighbors[i]), capacity,
+                              arc == noArc ? 0 : capacity - residual.capacities[arc]};
+            result->edgeFlows.push_back(edgeFlow);
+            if (reachable[node] and not reachable[neighbors[i]])
+            {
+                result->cutEdges.push_back(edgeFlow);
+            }
+        }
+    }
+    std::ranges::sort(result->sourceSide);
+}
+} // namespace Graphs::Algorithm
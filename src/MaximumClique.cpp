@@ -0,0 +1,410 @@
+// this
+#include <Graphs/MaximumClique.hpp>
+
+// libraries
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <Graphs/BitMatrix.hpp>
+#include <Graphs/CoreDecomposition.hpp>
+#include <Graphs/LineGraph.hpp>
+#include <Graphs/Parallel.hpp>
+#include <mutex>
+#include <span>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using Bitset = std::vector<uint64_t>;
+
+constexpr uint64_t clockCheckInterval = 1024;
+constexpr uint32_t greedyStarts = 16;
+
+struct ColoredNode
+{
+    uint32_t node;
+    uint32_t color;
+};
+
+/* Greedy clique grown from each of the nodes removed last, candidates taken in decreasing removal position */
+std::vector<NodeId> greedyClique(const std::vector<std::vector<NodeId>>& neighbors, const std::vector<NodeId>& removalOrder) {
+    std::vector<uint32_t> positions(neighbors.size());
+    for (uint32_t i = 0; i < removalOrder.size(); i++)
+    {
+        positions[removalOrder[i]] = i;
+    }
+
+    std::vector<NodeId> best;
+    const auto starts = std::min<std::size_t>(greedyStarts, removalOrder.size());
+    for (std::size_t i = 0; i < starts; i++)
+    {
+        auto start = removalOrder[removalOrder.size() - 1 - i];
+        auto candidates = neighbors[start];
+        std::ranges::sort(candidates, std::greater<>{}, [&positions](NodeId node) {
+            return positions[node];
+        });
+
+        std::vector<NodeId> clique = {start};
+        for (auto candidate : candidates)
+        {
+            auto adjacentToAll = std::ranges::all_of(clique, [&neighbors, candidate](NodeId member) {
+                return std::ranges::binary_search(neighbors[candidate], member);
+            });
+            if (adjacentToAll)
+            {
+                clique.push_back(candidate);
+            }
+        }
+        if (clique.size() > best.size())
+        {
+            best = std::move(clique);
+        }
+    }
+    return best;
+}
+
+/* Neighbors numbered above each node, sorted, in compressed rows */
+struct LaterNeighbors
+{
+    std::vector<std::size_t> offsets;
+    std::vector<uint32_t> targets;
+
+    std::span<const uint32_t> of(uint32_t node) const {
+        return {targets.data() + offsets[node], targets.data() + offsets[node + 1]};
+    }
+};
+
+class BranchAndBound
+{
+    public:
+    BranchAndBound(const LaterNeighbors& later,
+                   uint32_t maxDepth,
+                   uint32_t lowerBound,
+                   std::optional<Clock::time_point> deadline,
+                   const MaximumClique::ProgressCallback& progress)
+        : later(later), maxDepth(maxDepth), bestSize(lowerBound), start(Clock::now()), deadline(deadline),
+          progress(progress) {}
+
+    /*
+            Buffers of one thread: the adjacency of the current root's
+            candidates under local labels, one candidate set and one coloring
+            per depth. Every buffer is sized by the degeneracy, not the graph.
+    */
+    struct Worker
+    {
+        BitMatrix adjacency{0};
+        std::span<const uint32_t> localNodes;
+        std::size_t wordsCount = 0;
+        std::vector<Bitset> candidates;
+        std::vector<std::vector<ColoredNode>> colorings;
+        Bitset uncolored;
+        Bitset colorClass;
+        std::vector<uint32_t> clique;
+        uint64_t branches = 0;
+    };
+
+    Worker makeWorker() const {
+        Worker worker;
+        worker.candidates.resize(maxDepth + 2);
+        worker.colorings.resize(maxDepth + 2);
+        return worker;
+    }
+
+    /* Cliques containing root and only nodes numbered above it */
+    void searchRoot(Worker& worker, uint32_t root) {
+        auto localNodes = later.of(root);
+        const auto candidatesCount = static_cast<uint32_t>(localNodes.size());
+        if (candidatesCount + 1 <= bestSize.load(std::memory_order_relaxed) or stopped.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        worker.clique.assign(1, root);
+        if (candidatesCount == 0)
+        {
+            offer(worker.clique, worker.branches);
+            return;
+        }
+
+        // both rows are sorted, so one merge finds the local labels of the neighbors among the candidates
+        worker.localNodes = localNodes;
+        worker.adjacency.reset(candidatesCount);
+        for (uint32_t lhs = 0; lhs < candidatesCount; lhs++)
+        {
+            auto neighbors = later.of(localNodes[lhs]);
+            auto neighbor = neighbors.begin();
+            for (uint32_t rhs = lhs + 1; rhs < candidatesCount and neighbor != neighbors.end();)
+            {
+                if (*neighbor < localNodes[rhs])
+                {
+                    neighbor++;
+                }
+                else
+                {
+                    if (*neighbor == localNodes[rhs])
+                    {
+                        worker.adjacency.set(lhs, rhs);
+                        worker.adjacency.set(rhs, lhs);
+                        neighbor++;
+                    }
+                    rhs++;
+                }
+            }
+        }
+
+        worker.wordsCount = (static_cast<std::size_t>(candidatesCount) + 63) / 64;
+        for (auto& candidates : worker.candidates)
+        {
+            candidates.resize(worker.wordsCount);
+        }
+        worker.uncolored.resize(worker.wordsCount);
+        worker.colorClass.resize(worker.wordsCount);
+
+        auto& candidates = worker.candidates[1];
+        std::ranges::fill(candidates, ~uint64_t{0});
+        if (candidatesCount % 64 != 0)
+        {
+            candidates.back() = (uint64_t{1} << (candidatesCount % 64)) - 1;
+        }
+        expand(worker, 1);
+    }
+
+    /* Empty unless a clique larger than the lower bound was found */
+    std::vector<uint32_t> incumbent() {
+        std::scoped_lock lock(incumbentMutex);
+        return best;
+    }
+
+    bool interrupted() const {
+        return stopped.load();
+    }
+
+    private:
+    static std::optional<uint32_t> lowestBit(const Bitset& bits, std::size_t firstWord) {
+        for (auto word = firstWord; word < bits.size(); word++)
+        {
+            if (bits[word] != 0)
+            {
+                return static_cast<uint32_t>(word * 64 + std::countr_zero(bits[word]));
+            }
+        }
+        return std::nullopt;
+    }
+
+    /*
+            Colors the candidates class by class, each class is built by
+            taking the lowest candidate left and dropping its neighbors from
+            the class. Only nodes whose color can still beat the incumbent
+            are kept, in increasing color order.
+    */
+    void colorCandidates(Worker& worker, uint32_t depth) {
+        auto& coloring = worker.colorings[depth];
+        coloring.clear();
+        const auto minColor = static_cast<int64_t>(bestSize.load(std::memory_order_relaxed)) - depth + 1;
+
+        worker.uncolored = worker.candidates[depth];
+        for (uint32_t color = 1;; color++)
+        {
+            auto node = lowestBit(worker.uncolored, 0);
+            if (not node.has_value())
+            {
+                return;
+            }
+            worker.colorClass = worker.uncolored;
+            for (; node.has_value(); node = lowestBit(worker.colorClass, *node / 64))
+            {
+                worker.colorClass[*node / 64] &= ~(uint64_t{1} << (*node % 64));
+                worker.uncolored[*node / 64] &= ~(uint64_t{1} << (*node % 64));
+                auto row = worker.adjacency.row(*node);
+                for (std::size_t word = 0; word < worker.wordsCount; word++)
+                {
+                    worker.colorClass[word] &= ~row[word];
+                }
+                if (static_cast<int64_t>(color) >= minColor)
+                {
+                    coloring.push_back({*node, color});
+                }
+            }
+        }
+    }
+
+    void expand(Worker& worker, uint32_t depth) {
+        colorCandidates(worker, depth);
+        auto& candidates = worker.candidates[depth];
+        auto& next = worker.candidates[depth + 1];
+        const auto& coloring = worker.colorings[depth];
+
+        for (auto i = coloring.size(); i-- > 0;)
+        {
+            const auto [node, color] = coloring[i];
+            if (depth + color <= bestSize.load(std::memory_order_relaxed) or not countBranch(worker))
+            {
+                return;
+            }
+
+            bool empty = true;
+            auto row = worker.adjacency.row(node);
+            for (std::size_t word = 0; word < worker.wordsCount; word++)
+            {
+                next[word] = candidates[word] & row[word];
+                empty = empty and next[word] == 0;
+            }
+
+            worker.clique.push_back(worker.localNodes[node]);
+            if (empty)
+            {
+                offer(worker.clique, worker.branches);
+            }
+            else
+            {
+                expand(worker, depth + 1);
+            }
+            worker.clique.pop_back();
+            candidates[node / 64] &= ~(uint64_t{1} << (node % 64));
+        }
+    }
+
+    bool countBranch(Worker& worker) {
+        worker.branches++;
+        if (deadline.has_value() and worker.branches % clockCheckInterval == 0 and Clock::now() >= *deadline)
+        {
+            stopped.store(true, std::memory_order_relaxed);
+        }
+        return not stopped.load(std::memory_order_relaxed);
+    }
+
+    void offer(const std::vector<uint32_t>& clique, uint64_t branches) {
+        if (clique.size() <= bestSize.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        std::scoped_lock lock(incumbentMutex);
+        if (clique.size() <= bestSize.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        best = clique;
+        bestSize.store(static_cast<uint32_t>(best.size()), std::memory_order_relaxed);
+        if (progress)
+        {
+            progress({static_cast<uint32_t>(best.size()), branches,
+                      std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start)});
+        }
+    }
+
+    const LaterNeighbors& later;
+    const uint32_t maxDepth;
+
+    std::atomic<uint32_t> bestSize;
+    std::mutex incumbentMutex;
+    std::vector<uint32_t> best;
+
+    const Clock::time_point start;
+    const std::optional<Clock::time_point> deadline;
+    std::atomic<bool> stopped = false;
+    const MaximumClique::ProgressCallback& progress;
+};
+} // namespace
+
+void MaximumClique::operator()(const Graphs::Graph& graph) {
+    const auto started = Clock::now();
+    const EdgeIndex index(graph);
+    const auto nodesCount = index.nodesAmount();
+
+    auto cores = std::make_shared<CoreResult>();
+    CoreDecomposition{cores}(graph);
+
+    std::vector<NodeId> denseIds(cores->coreNumbers.size(), 0);
+    std::vector<std::vector<NodeId>> neighbors(nodesCount);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        denseIds[index.originalId(node)] = node;
+        for (auto edge : index.incidentEdges(node))
+        {
+            auto [lower, higher] = index.endpoints(edge);
+            neighbors[node].push_back(lower == node ? higher : lower);
+        }
+        std::ranges::sort(neighbors[node]);
+    }
+    std::vector<NodeId> removalOrder(nodesCount);
+    for (uint32_t i = 0; i < nodesCount; i++)
+    {
+        removalOrder[i] = denseIds[cores->removalOrder[i]];
+    }
+
+    // a clique larger than the greedy one only contains nodes of core number at least its size
+    auto initial = greedyClique(neighbors, removalOrder);
+    std::vector<NodeId> kept;
+    std::vector<uint32_t> labels(nodesCount, nodesCount);
+    for (auto node : removalOrder)
+    {
+        if (cores->coreNumbers[index.originalId(node)] >= initial.size())
+        {
+            labels[node] = static_cast<uint32_t>(kept.size());
+            kept.push_back(node);
+        }
+    }
+
+    const auto keptCount = static_cast<uint32_t>(kept.size());
+    LaterNeighbors later;
+    later.offsets.reserve(static_cast<std::size_t>(keptCount) + 1);
+    later.offsets.push_back(0);
+    for (uint32_t label = 0; label < keptCount; label++)
+    {
+        for (auto neighbor : neighbors[kept[label]])
+        {
+            if (labels[neighbor] != nodesCount and labels[neighbor] > label)
+            {
+                later.targets.push_back(labels[neighbor]);
+            }
+        }
+        std::sort(later.targets.begin() + static_cast<std::ptrdiff_t>(later.offsets.back()), later.targets.end());
+        later.offsets.push_back(later.targets.size());
+    }
+
+    std::optional<Clock::time_point> deadline;
+    if (timeLimit.has_value())
+    {
+        deadline = started + *timeLimit;
+    }
+    BranchAndBound search(later, cores->degeneracy + 1, static_cast<uint32_t>(initial.size()), deadline, progress);
+
+    // roots numbered last have the fewest candidates and the densest neighborhoods, they go first
+    std::vector<std::optional<BranchAndBound::Worker>> workers(Parallel::resolveThreadsCount(threadsCount));
+    Parallel::forEachDynamicChunk(0, keptCount, 1, threadsCount, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+        auto& worker = workers[thread];
+        if (not worker.has_value())
+        {
+            worker = search.makeWorker();
+        }
+        for (auto i = begin; i < end; i++)
+        {
+            search.searchRoot(*worker, static_cast<uint32_t>(keptCount - 1 - i));
+        }
+    });
+
+    result->clique.clear();
+    auto found = search.incumbent();
+    for (auto label : found)
+    {
+        result->clique.push_back(index.originalId(kept[label]));
+    }
+    if (found.empty())
+    {
+        for (auto node : initial)
+        {
+            result->clique.push_back(index.originalId(node));
+        }
+    }
+    std::ranges::sort(result->clique);
+
+    result->optimal = not search.interrupted();
+    result->branches = 0;
+    for (const auto& worker : workers)
+    {
+        result->branches += worker.has_value() ? worker->branches : 0;
+    }
+}
+} // namespace Graphs::Algorithm
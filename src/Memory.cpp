@@ -0,0 +1,261 @@
+// this
+#include <Graphs/Memory.hpp>
+
+// libraries
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <Graphs/Parallel.hpp>
+#include <new>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Graphs::Memory
+{
+namespace
+{
+#if defined(__linux__)
+std::size_t systemPageSize() {
+    static const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+std::size_t roundUp(std::size_t bytes, std::size_t granularity) {
+    return (bytes + granularity - 1) / granularity * granularity;
+}
+
+void* mapAnonymous(std::size_t bytes, int extraFlags) {
+    return mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extraFlags, -1, 0);
+}
+#endif
+} // namespace
+
+AllocationStats CountingResource::stats() const {
+    return {allocations.load(), deallocations.load(), allocatedBytes.load(), peakBytes.load()};
+}
+
+/* Restarts the counters, the peak starts again from the bytes still allocated */
+void CountingResource::reset() {
+    allocations = 0;
+    deallocations = 0;
+    allocatedBytes = 0;
+    peakBytes = liveBytes.load();
+}
+
+void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    auto* pointer = upstream->allocate(bytes, alignment);
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    auto live = liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    auto peak = peakBytes.load(std::memory_order_relaxed);
+    while (live > peak and not peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+    return pointer;
+}
+
+void CountingResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+    upstream->deallocate(pointer, bytes, alignment);
+    deallocations.fetch_add(1, std::memory_order_relaxed);
+    liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+std::string toString(PageSize pages) {
+    switch (pages)
+    {
+    case PageSize::transparentHuge:
+        return "transparent_huge";
+    case PageSize::hugeTlb:
+        return "hugetlb";
+    default:
+        return "standard";
+    }
+}
+
+std::string toString(NumaPolicy policy) {
+    switch (policy)
+    {
+    case NumaPolicy::interleave:
+        return "interleave";
+    case NumaPolicy::firstTouch:
+        return "first_touch";
+    default:
+        return "none";
+    }
+}
+
+/* Parses the kernel node list, e.g. "0-1,4" */
+std::vector<uint32_t> onlineNumaNodes() {
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string list;
+    std::vector<uint32_t> nodes;
+    if (not std::getline(file, list))
+    {
+        return {0};
+    }
+
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ','))
+    {
+        auto separator = range.find('-');
+        auto first = static_cast<uint32_t>(std::stoul(range.substr(0, separator)));
+        auto last = separator == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(separator + 1)));
+        for (auto node = first; node <= last; node++)
+        {
+            nodes.push_back(node);
+        }
+    }
+    return nodes.empty() ? std::vector<uint32_t>{0} : nodes;
+}
+
+PlacementResource::PlacementResource(Placement placement, std::pmr::memory_resource* upstream)
+    : placement(placement), upstream(upstream), numaNodes(onlineNumaNodes()) {}
+
+Placement PlacementResource::effective() const {
+#if defined(__linux__)
+    auto achieved = placement;
+    if (achieved.pages == PageSize::hugeTlb and hugeTlbUnavailable)
+    {
+        achieved.pages = PageSize::transparentHuge;
+    }
+    if (achieved.pages == PageSize::transparentHuge and transparentHugeUnavailable)
+    {
+        achieved.pages = PageSize::standard;
+    }
+    if (numaNodes.size() < 2 or numaUnavailable)
+    {
+        achieved.numa = NumaPolicy::none;
+    }
+    return achieved;
+#else
+    return {PageSize::standard, NumaPolicy::none, placement.threadsCount};
+#endif
+}
+
+#if defined(__linux__)
+bool PlacementResource::isMapped(std::size_t bytes) const {
+    return bytes >= hugePageSize and (placement.pages != PageSize::standard or placement.numa != NumaPolicy::none);
+}
+
+std::size_t PlacementResource::mappedSize(std::size_t bytes) const {
+    return roundUp(bytes, placement.pages == PageSize::standard ? systemPageSize() : hugePageSize);
+}
+
+void* PlacementResource::mapPages(std::size_t bytes) {
+    if (placement.pages == PageSize::hugeTlb and not hugeTlbUnavailable)
+    {
+        auto* pointer = mapAnonymous(bytes, MAP_HUGETLB);
+        if (pointer != MAP_FAILED)
+        {
+            return pointer;
+        }
+        hugeTlbUnavailable = true;
+    }
+
+    if (placement.pages == PageSize::standard)
+    {
+        auto* pointer = mapAnonymous(bytes, 0);
+        if (pointer == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        return pointer;
+    }
+
+    // huge pages back only 2 MiB aligned ranges, so the mapping is oversized and trimmed
+    auto* raw = static_cast<char*>(mapAnonymous(bytes + hugePageSize, 0));
+    if (raw == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+    auto head = roundUp(reinterpret_cast<std::uintptr_t>(raw), hugePageSize) - reinterpret_cast<std::uintptr_t>(raw);
+    if (head > 0)
+    {
+        munmap(raw, head);
+    }
+    if (head < hugePageSize)
+    {
+        munmap(raw + head + bytes, hugePageSize - head);
+    }
+    if (madvise(raw + head, bytes, MADV_HUGEPAGE) != 0)
+    {
+        transparentHugeUnavailable = true;
+    }
+    return raw + head;
+}
+
+void PlacementResource::applyNumaPolicy(void* pointer, std::size_t bytes) {
+    if (numaNodes.size() < 2)
+    {
+        return;
+    }
+
+    if (placement.numa == NumaPolicy::interleave)
+    {
+        constexpr std::size_t wordBits = sizeof(unsigned long) * CHAR_BIT;
+        std::vector<unsigned long> mask(*std::ranges::max_element(numaNodes) / wordBits + 1, 0);
+        for (auto node : numaNodes)
+        {
+            mask[node / wordBits] |= 1ul << (node % wordBits);
+        }
+        // the kernel reads one bit less than maxnode says
+        if (syscall(SYS_mbind, pointer, bytes, MPOL_INTERLEAVE, mask.data(), mask.size() * wordBits + 1, 0) != 0)
+        {
+            numaUnavailable = true;
+        }
+    }
+    else if (placement.numa == NumaPolicy::firstTouch)
+    {
+        const auto pageSize = systemPageSize();
+        auto* bytesPointer = static_cast<char*>(pointer);
+        Parallel::forEachChunk(0, bytes / pageSize, placement.threadsCount, [bytesPointer, pageSize](uint64_t begin, uint64_t end, uint32_t) {
+            for (auto page = begin; page < end; page++)
+            {
+                bytesPointer[page * pageSize] = 0;
+            }
+        });
+    }
+}
+
+#endif
+
+void* PlacementResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    if (isMapped(bytes))
+    {
+        const auto size = mappedSize(bytes);
+        auto* pointer = mapPages(size);
+        applyNumaPolicy(pointer, size);
+        return pointer;
+    }
+#endif
+    return upstream->allocate(bytes, alignment);
+}
+
+void PlacementResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    if (isMapped(bytes))
+    {
+        munmap(pointer, mappedSize(bytes));
+        return;
+    }
+#endif
+    upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool PlacementResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+} // namespace Graphs::Memory
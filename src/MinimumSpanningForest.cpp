@@ -0,0 +1,317 @@
+// this
+#include <Graphs/MinimumSpanningForest.hpp>
+
+// libraries
+#include <algorithm>
+#include <atomic>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/DaryHeap.hpp>
+#include <Graphs/DisjointSets.hpp>
+#include <Graphs/Parallel.hpp>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+using EdgeId = uint32_t;
+
+/*
+        Weight in the high half and edge id in the low half, so comparing
+        keys compares weights and breaks ties by edge id. Fits in a single
+        atomic word for the parallel Boruvka.
+*/
+using EdgeKey = uint64_t;
+constexpr EdgeKey noEdge = std::numeric_limits<EdgeKey>::max();
+
+struct Edges
+{
+    std::vector<NodeId> sources;
+    std::vector<NodeId> destinations;
+    std::vector<uint32_t> weights;
+
+    EdgeId size() const {
+        return static_cast<EdgeId>(sources.size());
+    }
+
+    EdgeKey key(EdgeId edge) const {
+        return static_cast<EdgeKey>(weights[edge]) << 32 | edge;
+    }
+};
+
+Edges collectEdges(const CsrGraph& graph) {
+    if (graph.edgesAmount() >= std::numeric_limits<EdgeId>::max())
+    {
+        throw std::length_error("Spanning forests support up to 2^32 - 1 edges");
+    }
+
+    Edges edges;
+    edges.sources.reserve(graph.edgesAmount());
+    edges.destinations.reserve(graph.edgesAmount());
+    edges.weights.reserve(graph.edgesAmount());
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        auto neighbors = graph.neighbors(node);
+        for (std::size_t i = 0; i < neighbors.size(); i++)
+        {
+            // self-loops never join two trees
+            if (neighbors[i] != node)
+            {
+                edges.sources.push_back(node);
+                edges.destinations.push_back(neighbors[i]);
+                edges.weights.push_back(graph.isWeighted() ? graph.weights(node)[i] : 1);
+            }
+        }
+    }
+    return edges;
+}
+
+std::vector<EdgeId> kruskal(const Edges& edges, uint32_t nodesCount, uint32_t threadsCount) {
+    std::vector<EdgeId> order(edges.size());
+    std::iota(order.begin(), order.end(), 0u);
+    Parallel::sort(order.begin(), order.end(), threadsCount, [&edges](EdgeId lhs, EdgeId rhs) {
+        return edges.key(lhs) < edges.key(rhs);
+    });
+
+    DisjointSets sets(nodesCount);
+    std::vector<EdgeId> chosen;
+    for (auto edge : order)
+    {
+        if (chosen.size() + 1 == nodesCount)
+        {
+            break;
+        }
+        if (sets.unite(edges.sources[edge], edges.destinations[edge]))
+        {
+            chosen.push_back(edge);
+        }
+    }
+    return chosen;
+}
+
+std::vector<EdgeId> prim(const Edges& edges, uint32_t nodesCount) {
+    std::vector<uint64_t> offsets(static_cast<std::size_t>(nodesCount) + 1, 0);
+    for (EdgeId edge = 0; edge < edges.size(); edge++)
+    {
+        offsets[edges.sources[edge] + 1]++;
+        offsets[edges.destinations[edge] + 1]++;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<EdgeId> incidence(offsets.back());
+    std::vector<uint64_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (EdgeId edge = 0; edge < edges.size(); edge++)
+    {
+        incidence[cursors[edges.sources[edge]]++] = edge;
+        incidence[cursors[edges.destinations[edge]]++] = edge;
+    }
+
+    DaryHeap<EdgeKey> heap(nodesCount);
+    std::vector<bool> inTree(nodesCount, false);
+    std::vector<EdgeId> chosen;
+    for (NodeId root = 0; root < nodesCount; root++)
+    {
+        if (inTree[root])
+        {
+            continue;
+        }
+        heap.push(root, noEdge);
+        while (not heap.empty())
+        {
+            auto node = heap.pop();
+            if (heap.key(node) != noEdge)
+            {
+                chosen.push_back(static_cast<EdgeId>(heap.key(node)));
+            }
+            inTree[node] = true;
+
+            for (auto position = offsets[node]; position < offsets[node + 1]; position++)
+            {
+                auto edge = incidence[position];
+                auto neighbor = edges.sources[edge] == node ? edges.destinations[edge] : edges.sources[edge];
+                if (not inTree[neighbor])
+                {
+                    heap.push(neighbor, edges.key(edge));
+                }
+            }
+        }
+    }
+    return chosen;
+}
+
+void lowerTo(std::atomic<EdgeKey>& best, EdgeKey key) {
+    auto current = best.load(std::memory_order_relaxed);
+    while (key < current and not best.compare_exchange_weak(current, key, std::memory_order_relaxed))
+    {
+    }
+}
+
+/*
+        Every round scans the edges still joining two components in parallel
+        and lowers the best key of both components atomically, then hooks
+        the picks through union-find and drops the edges that became inner.
+        With distinct keys the picks form a forest, so union only fails for
+        an edge picked by both of its components.
+*/
+std::vector<EdgeId> boruvka(const Edges& edges, uint32_t nodesCount, uint32_t threadsCount) {
+    const auto threads = Parallel::resolveThreadsCount(threadsCount);
+    std::vector<NodeId> components(nodesCount);
+    std::iota(components.begin(), components.end(), 0u);
+    std::vector<std::atomic<EdgeKey>> best(nodesCount);
+    std::vector<EdgeId> alive(edges.size());
+    std::iota(alive.begin(), alive.end(), 0u);
+    std::vector<std::vector<EdgeId>> survivors(threads);
+
+    DisjointSets sets(nodesCount);
+    std::vector<EdgeId> chosen;
+    while (not alive.empty())
+    {
+        Parallel::forEachChunk(0, nodesCount, threads, [&best](uint64_t begin, uint64_t end, uint32_t) {
+            for (auto node = begin; node < end; node++)
+            {
+                best[node].store(noEdge, std::memory_order_relaxed);
+            }
+        });
+        Parallel::forEachChunk(0, alive.size(), threads, [&](uint64_t begin, uint64_t end, uint32_t) {
+            for (auto i = begin; i < end; i++)
+            {
+                auto edge = alive[i];
+                auto key = edges.key(edge);
+                lowerTo(best[components[edges.sources[edge]]], key);
+                lowerTo(best[components[edges.destinations[edge]]], key);
+            }
+        });
+
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            auto key = best[node].load(std::memory_order_relaxed);
+            if (components[node] == node and key != noEdge)
+            {
+                auto edge = static_cast<EdgeId>(key);
+                if (sets.unite(edges.sources[edge], edges.destinations[edge]))
+                {
+                    chosen.push_back(edge);
+                }
+            }
+        }
+        for (NodeId node = 0; node < nodesCount; node++)
+        {
+            components[node] = sets.find(node);
+        }
+
+        Parallel::forEachChunk(0, alive.size(), threads, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+            auto& kept = survivors[thread];
+            kept.clear();
+            for (auto i = begin; i < end; i++)
+            {
+                auto edge = alive[i];
+                if (components[edges.sources[edge]] != components[edges.destinations[edge]])
+                {
+                    kept.push_back(edge);
+                }
+            }
+        });
+        alive.clear();
+        for (auto& kept : survivors)
+        {
+            alive.insert(alive.end(), kept.begin(), kept.end());
+            kept.clear();
+        }
+    }
+    return chosen;
+}
+
+void sortEdges(std::vector<EdgeInfo>& edges) {
+    std::ranges::sort(edges, [](const EdgeInfo& lhs, const EdgeInfo& rhs) {
+        return std::pair(lhs.source, lhs.destination) < std::pair(rhs.source, rhs.destination);
+    });
+}
+} // namespace
+
+void MinimumSpanningForest::operator()(const Graphs::Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+    const auto edges = collectEdges(csrGraph);
+
+    std::vector<EdgeId> chosen;
+    switch (method)
+    {
+    case Method::kruskal:
+        chosen = kruskal(edges, nodesCount, threadsCount);
+        break;
+    case Method::prim:
+        chosen = prim(edges, nodesCount);
+        break;
+    case Method::boruvka:
+        chosen = boruvka(edges, nodesCount, threadsCount);
+        break;
+    }
+
+    result->edges.clear();
+    result->edges.reserve(chosen.size());
+    result->totalWeight = 0;
+    for (auto edge : chosen)
+    {
+        result->edges.push_back({csrGraph.originalId(edges.sources[edge]), csrGraph.originalId(edges.destinations[edge]), edges.weights[edge]});
+        result->totalWeight += edges.weights[edge];
+    }
+    sortEdges(result->edges);
+    result->treesAmount = nodesCount - static_cast<uint32_t>(chosen.size());
+}
+
+StreamingSpanningForest::StreamingSpanningForest(uint32_t batchSize) : batchSize(std::max(batchSize, 1u)) {}
+
+void StreamingSpanningForest::insert(const EdgeInfo& edge) {
+    nodesCount = std::max({nodesCount, edge.source + 1, edge.destination + 1});
+    if (seen.size() < nodesCount)
+    {
+        seen.resize(nodesCount, false);
+    }
+    seen[edge.source] = true;
+    seen[edge.destination] = true;
+
+    if (edge.source != edge.destination)
+    {
+        pending.push_back({edge.source, edge.destination, edge.weight.value_or(1)});
+        // batches at least as large as the forest keep the merges amortized O(1) per edge
+        if (pending.size() >= std::max<std::size_t>(batchSize, forestEdges.size()))
+        {
+            flush();
+        }
+    }
+}
+
+/* The forest is kept in Kruskal order and merged ahead of the batch, which preserves arrival among equal weights */
+void StreamingSpanningForest::flush() {
+    std::ranges::stable_sort(pending, {}, &Edge::weight);
+    std::vector<Edge> merged;
+    merged.reserve(forestEdges.size() + pending.size());
+    std::ranges::merge(forestEdges, pending, std::back_inserter(merged), {}, &Edge::weight, &Edge::weight);
+    forestEdges = std::move(merged);
+    pending.clear();
+
+    DisjointSets sets(nodesCount);
+    std::erase_if(forestEdges, [&sets](const Edge& edge) {
+        return not sets.unite(edge.source, edge.destination);
+    });
+}
+
+SpanningForest StreamingSpanningForest::forest() {
+    flush();
+
+    SpanningForest forest;
+    forest.edges.reserve(forestEdges.size());
+    for (const auto& edge : forestEdges)
+    {
+        forest.edges.push_back({edge.source, edge.destination, edge.weight});
+        forest.totalWeight += edge.weight;
+    }
+    sortEdges(forest.edges);
+    forest.treesAmount = static_cast<uint32_t>(std::ranges::count(seen, true) - forestEdges.size());
+    return forest;
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,157 @@
+// this
+#include <Graphs/MultiSourceBfs.hpp>
+
+// libraries
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <Graphs/CsrGraph.hpp>
+#include <optional>
+#include <span>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+template <std::size_t wordsCount>
+struct Mask
+{
+    std::array<uint64_t, wordsCount> words = {};
+
+    bool any() const {
+        return std::ranges::any_of(words, [](uint64_t word) {
+            return word != 0;
+        });
+    }
+
+    Mask& operator|=(const Mask& other) {
+        for (std::size_t i = 0; i < wordsCount; i++)
+        {
+            words[i] |= other.words[i];
+        }
+        return *this;
+    }
+
+    void set(uint32_t bit) {
+        words[bit / 64] |= uint64_t{1} << (bit % 64);
+    }
+
+    /* Keeps only the bits missing in seen and adds them to seen */
+    void claimUnseen(Mask& seen) {
+        for (std::size_t i = 0; i < wordsCount; i++)
+        {
+            words[i] &= ~seen.words[i];
+            seen.words[i] |= words[i];
+        }
+    }
+
+    template <class Body>
+    void forEachBit(Body body) const {
+        for (std::size_t i = 0; i < wordsCount; i++)
+        {
+            for (auto word = words[i]; word != 0; word &= word - 1)
+            {
+                body(static_cast<uint32_t>(i * 64 + std::countr_zero(word)));
+            }
+        }
+    }
+};
+
+template <std::size_t wordsCount>
+void runBatches(const CsrGraph& graph, std::span<const NodeId> roots, const MultiSourceBfs::Visitor& visitor) {
+    constexpr uint32_t batchSize = wordsCount * 64;
+    const auto nodesCount = graph.nodesAmount();
+
+    std::vector<Mask<wordsCount>> seen(nodesCount);
+    std::vector<Mask<wordsCount>> visit(nodesCount);
+    std::vector<Mask<wordsCount>> visitNext(nodesCount);
+
+    for (uint32_t batchBegin = 0; batchBegin < roots.size(); batchBegin += batchSize)
+    {
+        const auto batch = roots.subspan(batchBegin, std::min<std::size_t>(batchSize, roots.size() - batchBegin));
+        std::ranges::fill(seen, Mask<wordsCount>{});
+        std::ranges::fill(visit, Mask<wordsCount>{});
+
+        for (uint32_t i = 0; i < batch.size(); i++)
+        {
+            seen[batch[i]].set(i);
+            visit[batch[i]].set(i);
+            visitor(batchBegin + i, graph.originalId(batch[i]), 0);
+        }
+
+        for (uint32_t level = 1;; level++)
+        {
+            std::ranges::fill(visitNext, Mask<wordsCount>{});
+            for (NodeId node = 0; node < nodesCount; node++)
+            {
+                if (not visit[node].any())
+                {
+                    continue;
+                }
+                for (auto neighbor : graph.neighbors(node))
+                {
+                    visitNext[neighbor] |= visit[node];
+                }
+            }
+
+            bool advanced = false;
+            for (NodeId node = 0; node < nodesCount; node++)
+            {
+                auto& next = visitNext[node];
+                next.claimUnseen(seen[node]);
+                if (not next.any())
+                {
+                    continue;
+                }
+                advanced = true;
+                next.forEachBit([&](uint32_t bit) {
+                    visitor(batchBegin + bit, graph.originalId(node), level);
+                });
+            }
+
+            if (not advanced)
+            {
+                break;
+            }
+            std::swap(visit, visitNext);
+        }
+    }
+}
+} // namespace
+
+void MultiSourceBfs::operator()(const Graphs::Graph& graph) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        maxNodeId = std::max(maxNodeId, csrGraph.originalId(node));
+    }
+    std::vector<NodeId> denseIds(nodesCount == 0 ? 0 : static_cast<std::size_t>(maxNodeId) + 1, nodesCount);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        denseIds[csrGraph.originalId(node)] = node;
+    }
+
+    std::vector<NodeId> roots(sources.size());
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        if (sources[i] >= denseIds.size() or denseIds[sources[i]] == nodesCount)
+        {
+            throw std::out_of_range("MS-BFS source is not a node of the graph");
+        }
+        roots[i] = denseIds[sources[i]];
+    }
+
+    if (width == Width::bits256)
+    {
+        runBatches<4>(csrGraph, roots, visitor);
+    }
+    else
+    {
+        runBatches<1>(csrGraph, roots, visitor);
+    }
+}
+} // namespace Graphs::Algorithm
@@ -2,8 +2,11 @@
 #include <Graphs/Pixel_map.hpp>
 
 // libraries
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 
 /*
         Function generating a randomized map of pixels in given
@@ -45,84 +48,301 @@ void Data::randomize_map(std::string file_path, uint32_t length, uint32_t width)
     file.close();
 }
 
+namespace
+{
+constexpr char binary_magic[8] = {'P', 'I', 'X', 'E', 'L', 'M', 'A', 'P'};
+constexpr uint32_t binary_version = 1;
+constexpr uint32_t bits_per_word = 64;
+constexpr std::size_t read_chunk_size = 1 << 20;
+
+uint32_t words_for_columns(uint32_t columns) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(columns) + bits_per_word - 1) / bits_per_word);
+}
+} // namespace
+
 /*
         Constructor reading provided file to load the map of pixels
-        in a matrix form. In case of passing a path to missing file,
-        returns a default empty object.
+        in a matrix form. Files with ".pmb" extension are read as binary
+        maps, any other file as a text map. In case of passing a path to
+        missing file, returns a default empty object.
 
         Params:
         file_path - path to the map file
+        storage   - whether to keep one byte or one bit per pixel
 
         Return:
         None
 */
-Data::Pixel_map::Pixel_map(std::string file_path)
-    : area_map(nullptr), rows(0), columns(0) {
-    std::ifstream file(file_path, std::ios::in);
+Data::Pixel_map::Pixel_map(std::string file_path, Storage storage)
+    : storage(storage), words_per_row(0), rows(0), columns(0) {
+    bool is_binary = file_path.size() >= 4 and file_path.compare(file_path.size() - 4, 4, ".pmb") == 0;
+
+    std::ifstream file(file_path, std::ios::in | std::ios::binary);
     if (file.good())
     {
-        std::string line;
+        if (is_binary)
+        {
+            this->load_binary(file);
+        }
+        else
+        {
+            this->load_text(file);
+        }
+    }
+    // if given file could not be opened correctly
+    else
+    {
+        std::cout << "File missing" << std::endl;
+    }
+}
 
-        std::getline(file, line);
-        size_t offset = 0;
-        size_t pos = 0;
+/*
+        Function loading a text map in a single pass over the file. The
+        columns count is taken from the first row, blank lines are skipped
+        and the last row does not need to end with a new line character.
 
-        // parse the line to calculate the columns count
-        while (true)
+        Params:
+        file - opened map file
+
+        Return:
+        None
+*/
+void Data::Pixel_map::load_text(std::ifstream& file) {
+    std::vector<char> buffer(read_chunk_size);
+    std::vector<uint8_t> first_row;
+
+    uint32_t column = 0;
+    uint32_t value = 0;
+    bool in_token = false;
+
+    auto end_token = [&]() {
+        if (not in_token)
         {
-            // search for space character that's inbetween
-            // each pixel
-            pos = line.find(' ', offset);
-            if (pos != std::string::npos)
-            {
-                this->columns++;
-                offset = pos + 1;
-            }
-            // when no more spaces are found, add the last column
-            // to the column count
-            else
+            return;
+        }
+        // the width of the map is known only after the first row
+        if (this->rows == 0)
+        {
+            first_row.push_back(static_cast<uint8_t>(value));
+        }
+        else if (column < this->columns)
+        {
+            this->set_pixel(this->rows, column, static_cast<uint8_t>(value));
+        }
+        column++;
+        value = 0;
+        in_token = false;
+    };
+
+    auto end_row = [&]() {
+        end_token();
+        if (column == 0)
+        {
+            return;
+        }
+        if (this->rows == 0)
+        {
+            this->columns = column;
+            this->words_per_row = words_for_columns(column);
+            this->resize_for_rows(1);
+            for (uint32_t j = 0; j < column; j++)
             {
-                this->columns++;
-                break;
+                this->set_pixel(0, j, first_row[j]);
             }
         }
-        // count the row that was just searched
+        else if (column != this->columns)
+        {
+            throw std::runtime_error("Pixel map rows differ in length");
+        }
         this->rows++;
+        column = 0;
+        // reserve the storage of the next row before its pixels arrive
+        this->resize_for_rows(this->rows + 1);
+    };
+
+    while (file)
+    {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        auto count = file.gcount();
 
-        // count subsequent rows
-        while (!file.eof() && line != "")
+        for (std::streamsize i = 0; i < count; i++)
         {
-            this->rows++;
-            std::getline(file, line);
+            char c = buffer[i];
+            if (c >= '0' and c <= '9')
+            {
+                value = value * 10 + static_cast<uint32_t>(c - '0');
+                in_token = true;
+            }
+            else if (c == '\n')
+            {
+                end_row();
+            }
+            else
+            {
+                end_token();
+            }
         }
+    }
+    end_row();
 
-        // create sufficiently big matrix
-        this->area_map = new uint8_t*[this->rows];
+    this->resize_for_rows(this->rows);
+    this->pixels.shrink_to_fit();
+    this->packed_pixels.shrink_to_fit();
+}
 
-        for (uint32_t i = 0; i < this->rows; i++)
+/*
+        Function loading a binary map: magic, version, rows and columns
+        followed by bit-packed rows padded to whole 64-bit words.
+
+        Params:
+        file - opened map file
+
+        Return:
+        None
+*/
+void Data::Pixel_map::load_binary(std::ifstream& file) {
+    char magic[sizeof(binary_magic)] = {};
+    uint32_t version = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (std::memcmp(magic, binary_magic, sizeof(magic)) != 0 or version != binary_version)
+    {
+        throw std::runtime_error("Unsupported binary pixel map file");
+    }
+
+    uint32_t rows = 0;
+    uint32_t columns = 0;
+    file.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+    file.read(reinterpret_cast<char*>(&columns), sizeof(columns));
+
+    // the header is checked against the file size before the pixels are allocated
+    auto position = file.tellg();
+    file.seekg(0, std::ios::end);
+    auto end = file.tellg();
+    file.seekg(position);
+    if (not file.good() or static_cast<uint64_t>(rows) * words_for_columns(columns) * sizeof(uint64_t) >
+                               static_cast<uint64_t>(end - position))
+    {
+        throw std::runtime_error("Truncated binary pixel map file");
+    }
+
+    this->rows = rows;
+    this->columns = columns;
+    this->words_per_row = words_for_columns(this->columns);
+    this->resize_for_rows(this->rows);
+
+    std::vector<uint64_t> row(this->words_per_row);
+    for (uint32_t i = 0; i < this->rows; i++)
+    {
+        uint64_t* destination = this->storage == Storage::bits
+                                  ? this->packed_pixels.data() + static_cast<std::size_t>(i) * this->words_per_row
+                                  : row.data();
+        file.read(reinterpret_cast<char*>(destination),
+                  static_cast<std::streamsize>(this->words_per_row * sizeof(uint64_t)));
+
+        if (this->storage == Storage::bytes)
         {
-            this->area_map[i] = new uint8_t[this->columns];
+            for (uint32_t j = 0; j < this->columns; j++)
+            {
+                this->set_pixel(i, j, static_cast<uint8_t>((row[j / bits_per_word] >> (j % bits_per_word)) & 1));
+            }
         }
+    }
+
+    if (not file.good())
+    {
+        throw std::runtime_error("Truncated binary pixel map file");
+    }
+}
 
-        // move to the beginning of the file
-        file.seekg(std::ios_base::beg);
+/*
+        Function saving the map in the binary format. Every pixel
+        different from zero is saved as one.
 
-        uint32_t temp;
+        Params:
+        file_path - path to the output file
 
-        // load the matrix from file
-        for (uint32_t i = 0; i < this->rows; i++)
+        Return:
+        None
+*/
+void Data::Pixel_map::save_binary(std::string file_path) const {
+    std::ofstream file(file_path, std::ios::out | std::ios::binary);
+    if (not file.good())
+    {
+        throw std::runtime_error("Error opening file");
+    }
+
+    file.write(binary_magic, sizeof(binary_magic));
+    file.write(reinterpret_cast<const char*>(&binary_version), sizeof(binary_version));
+    file.write(reinterpret_cast<const char*>(&this->rows), sizeof(this->rows));
+    file.write(reinterpret_cast<const char*>(&this->columns), sizeof(this->columns));
+
+    std::vector<uint64_t> row(this->words_per_row);
+    for (uint32_t i = 0; i < this->rows; i++)
+    {
+        const uint64_t* source = row.data();
+        if (this->storage == Storage::bits)
+        {
+            source = this->packed_pixels.data() + static_cast<std::size_t>(i) * this->words_per_row;
+        }
+        else
         {
+            std::fill(row.begin(), row.end(), 0);
             for (uint32_t j = 0; j < this->columns; j++)
             {
-                file >> temp;
-                this->area_map[i][j] = static_cast<uint8_t>(temp);
+                if (this->get_field(i, j) != 0)
+                {
+                    row[j / bits_per_word] |= uint64_t{1} << (j % bits_per_word);
+                }
             }
         }
+        file.write(reinterpret_cast<const char*>(source),
+                   static_cast<std::streamsize>(this->words_per_row * sizeof(uint64_t)));
+    }
+}
+
+/*
+        Function resizing the pixel buffer to hold given amount of rows.
+
+        Params:
+        rows_count - amount of rows to fit
+
+        Return:
+        None
+*/
+void Data::Pixel_map::resize_for_rows(uint32_t rows_count) {
+    if (this->storage == Storage::bits)
+    {
+        this->packed_pixels.resize(static_cast<std::size_t>(rows_count) * this->words_per_row, 0);
     }
-    // if given file could not be opened correctly
     else
     {
-        std::cout << "File missing" << std::endl;
+        this->pixels.resize(static_cast<std::size_t>(rows_count) * this->columns, 0);
+    }
+}
+
+/*
+        Setter for the pixel value of the map. In the bit-packed storage
+        every value different from zero is stored as one.
+
+        Params:
+        x     - X coordinate of the matrix
+        y     - Y coordinate of the matrix
+        value - value of the pixel
+
+        Return:
+        None
+*/
+void Data::Pixel_map::set_pixel(uint32_t x, uint32_t y, uint8_t value) {
+    if (this->storage == Storage::bits)
+    {
+        auto& word = this->packed_pixels[static_cast<std::size_t>(x) * this->words_per_row + y / bits_per_word];
+        auto mask = uint64_t{1} << (y % bits_per_word);
+        word = value != 0 ? (word | mask) : (word & ~mask);
+    }
+    else
+    {
+        this->pixels[static_cast<std::size_t>(x) * this->columns + y] = value;
     }
 }
 
@@ -169,7 +389,7 @@ void Data::Pixel_map::print_area_map() {
     {
         for (uint32_t j = 0; j < this->columns; j++)
         {
-            std::cout << static_cast<uint32_t>(this->area_map[i][j]);
+            std::cout << this->get_field(i, j);
             if (j < this->columns - 1)
             {
                 std::cout << " ";
@@ -217,16 +437,23 @@ uint32_t Data::Pixel_map::get_columns() const {
         value of the pixel
 */
 uint32_t Data::Pixel_map::get_field(uint32_t x, uint32_t y) const {
-    return static_cast<uint32_t>(this->area_map[x][y]);
+    if (this->storage == Storage::bits)
+    {
+        auto word = this->packed_pixels[static_cast<std::size_t>(x) * this->words_per_row + y / bits_per_word];
+        return static_cast<uint32_t>((word >> (y % bits_per_word)) & 1);
+    }
+    return static_cast<uint32_t>(this->pixels[static_cast<std::size_t>(x) * this->columns + y]);
 }
 
 /*
-        Destructor cleaning up the memory allocation
+        Storage getter
+
+        Params:
+        None
+
+        Return:
+        the way the pixels are stored
 */
-Data::Pixel_map::~Pixel_map() {
-    for (uint32_t i = 0; i < this->rows; i++)
-    {
-        delete[] this->area_map[i];
-    }
-    delete[] this->area_map;
+Data::Pixel_map::Storage Data::Pixel_map::get_storage() const {
+    return this->storage;
 }
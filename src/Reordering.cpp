@@ -0,0 +1,426 @@
+// this
+#include <Graphs/Reordering.hpp>
+
+// libraries
+#include <algorithm>
+#include <cmath>
+#include <Graphs/LineGraph.hpp>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+namespace Graphs
+{
+namespace
+{
+constexpr NodeId none = std::numeric_limits<NodeId>::max();
+
+template <class Visitor>
+void forEachUndirectedNeighbor(const EdgeIndex& index, NodeId node, Visitor visitor) {
+    for (auto edge : index.incidentEdges(node))
+    {
+        auto [lower, higher] = index.endpoints(edge);
+        visitor(lower == node ? higher : lower);
+    }
+}
+
+uint32_t undirectedDegree(const EdgeIndex& index, NodeId node) {
+    return static_cast<uint32_t>(index.incidentEdges(node).size());
+}
+
+/* Nodes by non-increasing undirected degree, ties kept in id order by a counting sort */
+std::vector<NodeId> degreeOrder(const EdgeIndex& index) {
+    const auto nodesCount = index.nodesAmount();
+    uint32_t maxDegree = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        maxDegree = std::max(maxDegree, undirectedDegree(index, node));
+    }
+
+    // bucket starts are counted from the highest degree down
+    std::vector<std::size_t> bucketStarts(static_cast<std::size_t>(maxDegree) + 2, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        bucketStarts[maxDegree - undirectedDegree(index, node) + 1]++;
+    }
+    std::partial_sum(bucketStarts.begin(), bucketStarts.end(), bucketStarts.begin());
+
+    std::vector<NodeId> order(nodesCount);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        order[bucketStarts[maxDegree - undirectedDegree(index, node)]++] = node;
+    }
+    return order;
+}
+
+/*
+        Cuthill-McKee visit of the component of a root: BFS where the newly
+        found neighbors of every node are appended by increasing degree.
+        Marks hold the number of the last visit that reached a node, so they
+        never have to be cleared.
+*/
+class CuthillMcKee
+{
+    public:
+    CuthillMcKee(const EdgeIndex& index) : index(index), marks(index.nodesAmount(), 0) {}
+
+    void visit(NodeId root) {
+        mark++;
+        order.assign(1, root);
+        levelStarts.assign(1, 0);
+        marks[root] = mark;
+        for (std::size_t begin = 0; begin < order.size();)
+        {
+            const auto end = order.size();
+            for (auto head = begin; head < end; head++)
+            {
+                neighbors.clear();
+                forEachUndirectedNeighbor(index, order[head], [this](NodeId neighbor) {
+                    if (marks[neighbor] != mark)
+                    {
+                        marks[neighbor] = mark;
+                        neighbors.push_back(neighbor);
+                    }
+                });
+                std::ranges::sort(neighbors, [this](NodeId lhs, NodeId rhs) {
+                    return std::pair(undirectedDegree(index, lhs), lhs) < std::pair(undirectedDegree(index, rhs), rhs);
+                });
+                order.insert(order.end(), neighbors.begin(), neighbors.end());
+            }
+            if (order.size() > end)
+            {
+                levelStarts.push_back(end);
+            }
+            begin = end;
+        }
+    }
+
+    uint32_t depth() const {
+        return static_cast<uint32_t>(levelStarts.size());
+    }
+
+    NodeId lastLevelMinimumDegree() const {
+        return *std::ranges::min_element(order.begin() + static_cast<std::ptrdiff_t>(levelStarts.back()), order.end(), {},
+                                          [this](NodeId node) {
+                                              return undirectedDegree(index, node);
+                                          });
+    }
+
+    const std::vector<NodeId>& visited() const {
+        return order;
+    }
+
+    private:
+    const EdgeIndex& index;
+    std::vector<uint32_t> marks;
+    uint32_t mark = 0;
+    std::vector<NodeId> order;
+    std::vector<std::size_t> levelStarts;
+    std::vector<NodeId> neighbors;
+};
+
+std::vector<NodeId> reverseCuthillMcKeeOrder(const EdgeIndex& index) {
+    const auto nodesCount = index.nodesAmount();
+    std::vector<NodeId> starts(nodesCount);
+    std::iota(starts.begin(), starts.end(), 0u);
+    std::ranges::stable_sort(starts, {}, [&index](NodeId node) {
+        return undirectedDegree(index, node);
+    });
+
+    CuthillMcKee cuthillMcKee(index);
+    std::vector<bool> placed(nodesCount, false);
+    std::vector<NodeId> order;
+    order.reserve(nodesCount);
+    for (auto start : starts)
+    {
+        if (placed[start])
+        {
+            continue;
+        }
+
+        // George-Liu pseudo-peripheral root: move to the last level while the BFS gets deeper
+        auto root = start;
+        cuthillMcKee.visit(root);
+        for (auto depth = cuthillMcKee.depth();;)
+        {
+            auto candidate = cuthillMcKee.lastLevelMinimumDegree();
+            cuthillMcKee.visit(candidate);
+            if (cuthillMcKee.depth() <= depth)
+            {
+                cuthillMcKee.visit(root);
+                break;
+            }
+            root = candidate;
+            depth = cuthillMcKee.depth();
+        }
+
+        for (auto node : cuthillMcKee.visited())
+        {
+            placed[node] = true;
+        }
+        order.insert(order.end(), cuthillMcKee.visited().begin(), cuthillMcKee.visited().end());
+    }
+
+    std::ranges::reverse(order);
+    return order;
+}
+
+/*
+        Max-priority queue of nodes with small integer scores, kept as doubly
+        linked lists per score. Decreases are only recorded and applied when
+        the node reaches the top, an increase first cancels recorded
+        decreases without moving the node. Popping the maximum scans
+        down from the highest score seen over empty lists.
+*/
+class UnitHeap
+{
+    public:
+    UnitHeap(uint32_t size) : scores(size, 0), pending(size, 0), previous(size), next(size), heads(1, none) {
+        for (NodeId node = 0; node < size; node++)
+        {
+            link(node);
+        }
+    }
+
+    void remove(NodeId node) {
+        unlink(node);
+        scores[node] = removed;
+    }
+
+    void increase(NodeId node, uint32_t amount) {
+        if (scores[node] == removed)
+        {
+            return;
+        }
+        const auto cancelled = std::min(amount, pending[node]);
+        pending[node] -= cancelled;
+        if (amount == cancelled)
+        {
+            return;
+        }
+        unlink(node);
+        scores[node] += amount - cancelled;
+        if (scores[node] >= heads.size())
+        {
+            heads.resize(static_cast<std::size_t>(scores[node]) + 1, none);
+        }
+        top = std::max(top, scores[node]);
+        link(node);
+    }
+
+    void decrease(NodeId node, uint32_t amount) {
+        if (scores[node] != removed)
+        {
+            pending[node] += amount;
+        }
+    }
+
+    NodeId popMaximum() {
+        while (true)
+        {
+            while (heads[top] == none)
+            {
+                top--;
+            }
+            auto node = heads[top];
+            if (pending[node] == 0)
+            {
+                remove(node);
+                return node;
+            }
+            unlink(node);
+            scores[node] -= std::exchange(pending[node], 0);
+            link(node);
+        }
+    }
+
+    private:
+    static constexpr uint32_t removed = std::numeric_limits<uint32_t>::max();
+
+    void link(NodeId node) {
+        auto& head = heads[scores[node]];
+        previous[node] = none;
+        next[node] = head;
+        if (head != none)
+        {
+            previous[head] = node;
+        }
+        head = node;
+    }
+
+    void unlink(NodeId node) {
+        if (previous[node] != none)
+        {
+            next[previous[node]] = next[node];
+        }
+        else
+        {
+            heads[scores[node]] = next[node];
+        }
+        if (next[node] != none)
+        {
+            previous[next[node]] = previous[node];
+        }
+    }
+
+    std::vector<uint32_t> scores;
+    std::vector<uint32_t> pending;
+    std::vector<NodeId> previous;
+    std::vector<NodeId> next;
+    std::vector<NodeId> heads;
+    uint32_t top = 0;
+};
+
+std::vector<NodeId> gorderOrder(const EdgeIndex& index, uint32_t window) {
+    const auto nodesCount = index.nodesAmount();
+    std::vector<NodeId> order;
+    if (nodesCount == 0)
+    {
+        return order;
+    }
+    order.reserve(nodesCount);
+    const auto hubDegree = static_cast<uint32_t>(std::sqrt(static_cast<double>(nodesCount)));
+
+    // the scoring walks dominate, so they run over plain neighbor lists rather than through edge ids
+    std::vector<uint64_t> offsets(static_cast<std::size_t>(nodesCount) + 1, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        offsets[node + 1] = offsets[node] + undirectedDegree(index, node);
+    }
+    std::vector<NodeId> adjacency(offsets.back());
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        auto position = offsets[node];
+        forEachUndirectedNeighbor(index, node, [&adjacency, &position](NodeId neighbor) {
+            adjacency[position++] = neighbor;
+        });
+    }
+    auto forEachNeighbor = [&offsets, &adjacency](NodeId node, auto visitor) {
+        for (auto position = offsets[node]; position < offsets[node + 1]; position++)
+        {
+            visitor(adjacency[position]);
+        }
+    };
+
+    // a placed node scores its neighbors and, through non-hub neighbors, their other neighbors
+    UnitHeap heap(nodesCount);
+    std::vector<uint32_t> counts(nodesCount, 0);
+    std::vector<NodeId> touched;
+    auto update = [&](NodeId node, bool entering) {
+        auto touch = [&counts, &touched](NodeId neighbor) {
+            touched.push_back(neighbor);
+            counts[neighbor]++;
+        };
+        forEachNeighbor(node, [&](NodeId neighbor) {
+            touch(neighbor);
+            if (offsets[neighbor + 1] - offsets[neighbor] <= hubDegree)
+            {
+                forEachNeighbor(neighbor, touch);
+            }
+        });
+        // repeated scores of a node are summed first, so it moves between lists at most once
+        for (auto neighbor : touched)
+        {
+            if (counts[neighbor] > 0)
+            {
+                entering ? heap.increase(neighbor, counts[neighbor]) : heap.decrease(neighbor, counts[neighbor]);
+                counts[neighbor] = 0;
+            }
+        }
+        touched.clear();
+    };
+
+    NodeId first = 0;
+    for (NodeId node = 1; node < nodesCount; node++)
+    {
+        first = undirectedDegree(index, node) > undirectedDegree(index, first) ? node : first;
+    }
+    heap.remove(first);
+    order.push_back(first);
+
+    while (order.size() < nodesCount)
+    {
+        update(order.back(), true);
+        if (order.size() > window)
+        {
+            update(order[order.size() - window - 1], false);
+        }
+        order.push_back(heap.popMaximum());
+    }
+    return order;
+}
+
+CsrGraph relabel(const CsrGraph& graph, const std::vector<NodeId>& order, const std::vector<NodeId>& newIds) {
+    const auto nodesCount = graph.nodesAmount();
+    std::pmr::vector<CsrGraph::Offset> offsets(static_cast<std::size_t>(nodesCount) + 1, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        offsets[node + 1] = offsets[node] + graph.nodeDegree(order[node]);
+    }
+
+    std::pmr::vector<NodeId> adjacency(offsets.back());
+    std::pmr::vector<uint32_t> weights(graph.isWeighted() ? offsets.back() : 0);
+    std::vector<std::pair<NodeId, uint32_t>> row;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        auto neighbors = graph.neighbors(order[node]);
+        auto rowWeights = graph.weights(order[node]);
+        row.clear();
+        for (std::size_t i = 0; i < neighbors.size(); i++)
+        {
+            row.emplace_back(newIds[neighbors[i]], graph.isWeighted() ? rowWeights[i] : 1);
+        }
+        std::ranges::sort(row);
+        for (std::size_t i = 0; i < row.size(); i++)
+        {
+            adjacency[offsets[node] + i] = row[i].first;
+            if (graph.isWeighted())
+            {
+                weights[offsets[node] + i] = row[i].second;
+            }
+        }
+    }
+
+    CsrGraph relabeled(std::move(offsets), std::move(adjacency), std::move(weights));
+    relabeled.metadata() = graph.metadata();
+    return relabeled;
+}
+} // namespace
+
+Relabeling reorder(const Graph& graph, Ordering ordering, uint32_t window) {
+    std::optional<CsrGraph> converted;
+    const auto& csrGraph = CsrGraph::from(graph, converted);
+    const auto nodesCount = csrGraph.nodesAmount();
+
+    std::vector<NodeId> order;
+    switch (ordering)
+    {
+    case Ordering::degree:
+        order = degreeOrder(EdgeIndex(csrGraph));
+        break;
+    case Ordering::reverseCuthillMcKee:
+        order = reverseCuthillMcKeeOrder(EdgeIndex(csrGraph));
+        break;
+    case Ordering::gorder:
+        order = gorderOrder(EdgeIndex(csrGraph), std::max(window, 1u));
+        break;
+    }
+
+    std::vector<NodeId> newIds(nodesCount);
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        newIds[order[node]] = node;
+        maxNodeId = std::max(maxNodeId, csrGraph.originalId(node));
+    }
+
+    Relabeling relabeling{relabel(csrGraph, order, newIds), std::vector<NodeId>(nodesCount == 0 ? 0 : maxNodeId + 1, Relabeling::noNode),
+                          std::vector<NodeId>(nodesCount)};
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        relabeling.inverse[node] = csrGraph.originalId(order[node]);
+        relabeling.permutation[relabeling.inverse[node]] = node;
+    }
+    return relabeling;
+}
+} // namespace Graphs
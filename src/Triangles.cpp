@@ -0,0 +1,244 @@
+// this
+#include <Graphs/Triangles.hpp>
+
+// libraries
+#include <algorithm>
+#include <bit>
+#include <Graphs/BitMatrix.hpp>
+#include <Graphs/LineGraph.hpp>
+#include <Graphs/Parallel.hpp>
+#include <optional>
+#include <span>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+constexpr std::size_t blockWidth = 8;
+constexpr std::size_t skewRatio = 32;
+constexpr uint64_t dynamicGrain = 1024;
+
+/*
+        Nodes relabeled by rank, i.e. by increasing degree (ties by id), with
+        every edge kept only at its endpoint of lower rank. Out-neighbors then
+        always have higher ranks and the hubs end up next to each other.
+*/
+struct Oriented
+{
+    std::vector<NodeId> ranks;
+    std::vector<uint64_t> offsets;
+    std::vector<NodeId> targets;
+
+    std::span<const NodeId> outNeighbors(NodeId rank) const {
+        return {targets.data() + offsets[rank], targets.data() + offsets[rank + 1]};
+    }
+};
+
+Oriented orient(const EdgeIndex& index) {
+    const auto nodesCount = index.nodesAmount();
+    Oriented oriented{std::vector<NodeId>(nodesCount), std::vector<uint64_t>(static_cast<std::size_t>(nodesCount) + 1, 0), {}};
+
+    std::vector<uint32_t> bucketStarts(static_cast<std::size_t>(index.maxDegree()) + 2, 0);
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        bucketStarts[index.incidentEdges(node).size() + 1]++;
+    }
+    for (std::size_t degree = 1; degree < bucketStarts.size(); degree++)
+    {
+        bucketStarts[degree] += bucketStarts[degree - 1];
+    }
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        oriented.ranks[node] = bucketStarts[index.incidentEdges(node).size()]++;
+    }
+
+    for (const auto& [lower, higher] : index.allEndpoints())
+    {
+        oriented.offsets[std::min(oriented.ranks[lower], oriented.ranks[higher]) + 1]++;
+    }
+    for (NodeId rank = 0; rank < nodesCount; rank++)
+    {
+        oriented.offsets[rank + 1] += oriented.offsets[rank];
+    }
+
+    oriented.targets.resize(oriented.offsets.back());
+    std::vector<uint64_t> cursors(oriented.offsets.begin(), oriented.offsets.end() - 1);
+    for (const auto& [lower, higher] : index.allEndpoints())
+    {
+        auto [from, to] = std::minmax(oriented.ranks[lower], oriented.ranks[higher]);
+        oriented.targets[cursors[from]++] = to;
+    }
+    for (NodeId rank = 0; rank < nodesCount; rank++)
+    {
+        std::sort(oriented.targets.begin() + static_cast<std::ptrdiff_t>(oriented.offsets[rank]),
+                  oriented.targets.begin() + static_cast<std::ptrdiff_t>(oriented.offsets[rank + 1]));
+    }
+    return oriented;
+}
+
+/*
+        Intersection of two sorted lists without duplicates. Whole blocks are
+        compared all-pairs into a match mask, then the block ending with the
+        smaller element is consumed (both on a tie), so every common element
+        is reported exactly once.
+*/
+template <class Visitor>
+void forEachCommon(std::span<const NodeId> lhs, std::span<const NodeId> rhs, Visitor visitor) {
+    if (lhs.size() > rhs.size())
+    {
+        std::swap(lhs, rhs);
+    }
+    // a short list against a hub list is cheaper with binary searches than with a merge
+    if (lhs.size() * skewRatio < rhs.size())
+    {
+        auto position = rhs.begin();
+        for (auto node : lhs)
+        {
+            position = std::lower_bound(position, rhs.end(), node);
+            if (position == rhs.end())
+            {
+                return;
+            }
+            if (*position == node)
+            {
+                visitor(node);
+            }
+        }
+        return;
+    }
+
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i + blockWidth <= lhs.size() and j + blockWidth <= rhs.size())
+    {
+        uint32_t matches = 0;
+        for (std::size_t a = 0; a < blockWidth; a++)
+        {
+            uint32_t found = 0;
+            for (std::size_t b = 0; b < blockWidth; b++)
+            {
+                found |= lhs[i + a] == rhs[j + b] ? 1 : 0;
+            }
+            matches |= found << a;
+        }
+        for (; matches != 0; matches &= matches - 1)
+        {
+            visitor(lhs[i + std::countr_zero(matches)]);
+        }
+
+        auto lhsLast = lhs[i + blockWidth - 1];
+        auto rhsLast = rhs[j + blockWidth - 1];
+        i += lhsLast <= rhsLast ? blockWidth : 0;
+        j += rhsLast <= lhsLast ? blockWidth : 0;
+    }
+
+    while (i < lhs.size() and j < rhs.size())
+    {
+        if (lhs[i] < rhs[j])
+        {
+            i++;
+        }
+        else if (rhs[j] < lhs[i])
+        {
+            j++;
+        }
+        else
+        {
+            visitor(lhs[i]);
+            i++;
+            j++;
+        }
+    }
+}
+
+bool preferBitmap(const EdgeIndex& index) {
+    const auto nodesCount = index.nodesAmount();
+    if (nodesCount == 0 or nodesCount > TriangleCounting::maxBitmapNodes)
+    {
+        return false;
+    }
+    const auto rowWords = (nodesCount + 63) / 64;
+    const auto averageDegree = 2.0 * index.edgesAmount() / nodesCount;
+    return rowWords <= averageDegree;
+}
+} // namespace
+
+void TriangleCounting::operator()(const Graphs::Graph& graph) {
+    const EdgeIndex index(graph);
+    const auto nodesCount = index.nodesAmount();
+    const auto oriented = orient(index);
+
+    std::optional<BitMatrix> bitmap;
+    if (kernel == Kernel::bitmap or (kernel == Kernel::automatic and preferBitmap(index)))
+    {
+        bitmap.emplace(nodesCount);
+        for (NodeId rank = 0; rank < nodesCount; rank++)
+        {
+            for (auto target : oriented.outNeighbors(rank))
+            {
+                bitmap->set(rank, target);
+            }
+        }
+    }
+
+    std::vector<std::vector<uint64_t>> partials(Parallel::resolveThreadsCount(threadsCount));
+    // the cost per rank varies widely and hubs sit next to each other in rank order
+    Parallel::forEachDynamicChunk(0, nodesCount, dynamicGrain, threadsCount, [&](uint64_t begin, uint64_t end, uint32_t thread) {
+        auto& counts = partials[thread];
+        counts.resize(nodesCount, 0);
+        for (auto rank = static_cast<NodeId>(begin); rank < end; rank++)
+        {
+            for (auto target : oriented.outNeighbors(rank))
+            {
+                auto count = [&counts, rank, target](NodeId third) {
+                    counts[rank]++;
+                    counts[target]++;
+                    counts[third]++;
+                };
+                if (bitmap.has_value())
+                {
+                    bitmap->forEachCommon(rank, target, count);
+                }
+                else
+                {
+                    forEachCommon(oriented.outNeighbors(rank), oriented.outNeighbors(target), count);
+                }
+            }
+        }
+    });
+
+    NodeId maxNodeId = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        maxNodeId = std::max(maxNodeId, index.originalId(node));
+    }
+    const auto size = nodesCount == 0 ? 0 : static_cast<std::size_t>(maxNodeId) + 1;
+    result->nodeTriangles.assign(size, 0);
+    result->clustering.assign(size, 0);
+
+    uint64_t corners = 0;
+    uint64_t wedges = 0;
+    double clusteringSum = 0;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        uint64_t triangles = 0;
+        for (const auto& counts : partials)
+        {
+            triangles += counts.empty() ? 0 : counts[oriented.ranks[node]];
+        }
+        const uint64_t degree = index.incidentEdges(node).size();
+        const auto nodeWedges = degree * (degree - (degree > 0 ? 1 : 0)) / 2;
+        const auto clustering = nodeWedges == 0 ? 0.0 : static_cast<double>(triangles) / nodeWedges;
+
+        result->nodeTriangles[index.originalId(node)] = triangles;
+        result->clustering[index.originalId(node)] = clustering;
+        corners += triangles;
+        wedges += nodeWedges;
+        clusteringSum += clustering;
+    }
+
+    result->triangles = corners / 3;
+    result->averageClustering = nodesCount == 0 ? 0 : clusteringSum / nodesCount;
+    result->transitivity = wedges == 0 ? 0 : static_cast<double>(corners) / wedges;
+}
+} // namespace Graphs::Algorithm
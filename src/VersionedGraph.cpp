@@ -0,0 +1,133 @@
+// this
+#include <Graphs/VersionedGraph.hpp>
+
+// libraries
+#include <algorithm>
+#include <stdexcept>
+
+namespace Graphs
+{
+VersionedGraph::ReadGuard::ReadGuard(Reader& reader, const Snapshot& snapshot) : reader(reader), snapshot(snapshot) {}
+
+VersionedGraph::ReadGuard::~ReadGuard() {
+    if (--reader.depth == 0)
+    {
+        reader.owner->unpin(reader.slot);
+    }
+}
+
+VersionedGraph::Reader::Reader(VersionedGraph& owner, std::size_t slot) : owner(&owner), slot(slot) {}
+
+VersionedGraph::Reader::~Reader() {
+    owner->slots[slot].used.store(false, std::memory_order_release);
+}
+
+VersionedGraph::ReadGuard VersionedGraph::Reader::read() {
+    // nested guards keep the first announced epoch, which only delays reclamation
+    const auto& snapshot = owner->pin(slot, depth == 0);
+    depth++;
+    return ReadGuard(*this, snapshot);
+}
+
+VersionedGraph::VersionedGraph(const Graph& graph, uint32_t readersCount)
+    : staging(graph), publishedRevision(staging.revision()), slots(std::make_unique<ReaderSlot[]>(readersCount)),
+      slotsCount(readersCount), current(new Snapshot{0, staging.toCsr()}) {}
+
+VersionedGraph::~VersionedGraph() {
+    for (const auto& entry : retired)
+    {
+        delete entry.snapshot;
+    }
+    delete current.load();
+}
+
+VersionedGraph::Reader VersionedGraph::reader() {
+    for (std::size_t i = 0; i < slotsCount; i++)
+    {
+        bool expected = false;
+        if (slots[i].used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            return Reader(*this, i);
+        }
+    }
+    throw std::runtime_error("No free reader slot in the versioned graph");
+}
+
+/*
+        The announcement and both loads are sequentially consistent: a writer
+        that does not see this announcement has already swapped the pointer,
+        so the load below returns the new snapshot, never the retired one.
+*/
+const Snapshot& VersionedGraph::pin(std::size_t slot, bool announce) {
+    if (announce)
+    {
+        slots[slot].epoch.store(globalEpoch.load());
+    }
+    return *current.load();
+}
+
+void VersionedGraph::unpin(std::size_t slot) {
+    slots[slot].epoch.store(idle, std::memory_order_release);
+}
+
+void VersionedGraph::setEdges(std::span<const EdgeInfo> edges) {
+    std::scoped_lock lock(writerMutex);
+    staging.setEdges(edges);
+}
+
+void VersionedGraph::removeEdges(std::span<const EdgeInfo> edges) {
+    std::scoped_lock lock(writerMutex);
+    staging.removeEdges(edges);
+}
+
+void VersionedGraph::addNodes(uint32_t nodesCount) {
+    std::scoped_lock lock(writerMutex);
+    staging.addNodes(nodesCount);
+}
+
+void VersionedGraph::removeNode(NodeId node) {
+    std::scoped_lock lock(writerMutex);
+    staging.removeNode(node);
+}
+
+uint64_t VersionedGraph::publish() {
+    std::scoped_lock lock(writerMutex);
+    if (staging.revision() != publishedRevision)
+    {
+        const auto version = publishedVersion.load(std::memory_order_relaxed) + 1;
+        auto previous = current.exchange(new Snapshot{version, staging.toCsr()});
+        // readers announcing this epoch or a later one can only load the new snapshot
+        retired.push_back({previous, globalEpoch.fetch_add(1) + 1});
+        publishedVersion.store(version, std::memory_order_release);
+        publishedRevision = staging.revision();
+    }
+    reclaim();
+    return publishedVersion.load(std::memory_order_relaxed);
+}
+
+void VersionedGraph::reclaim() {
+    auto oldestEpoch = idle;
+    for (std::size_t i = 0; i < slotsCount; i++)
+    {
+        oldestEpoch = std::min(oldestEpoch, slots[i].epoch.load());
+    }
+
+    std::erase_if(retired, [oldestEpoch](const Retired& entry) {
+        if (entry.epoch > oldestEpoch)
+        {
+            return false;
+        }
+        delete entry.snapshot;
+        return true;
+    });
+}
+
+uint64_t VersionedGraph::version() const {
+    return publishedVersion.load(std::memory_order_acquire);
+}
+
+std::size_t VersionedGraph::retiredAmount() const {
+    std::scoped_lock lock(writerMutex);
+    return retired.size();
+}
+} // namespace Graphs
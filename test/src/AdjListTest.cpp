@@ -0,0 +1,100 @@
+#include <Graphs/AdjList.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string lstFile = "../test/sample/adjList.lst";
+
+namespace Graphs
+{
+TEST(AdjListTest, setEdgesMergesSortedNeighbors) {
+    AdjList adjList(lstFile);
+
+    std::vector<EdgeInfo> edges = {
+        {1, 9},
+        {3, 1},
+        {1, 3},
+        {1, 100},
+        {3, 10}
+    };
+    // edges to nodes 10 and 100 are skipped, the sample has nodes 1-9
+    adjList.setEdges(edges);
+
+    ASSERT_EQ(std::vector<NodeId>({2, 3, 6, 9}), adjList.getNeighborsOf(1));
+    ASSERT_EQ(std::vector<NodeId>({1, 4, 7}), adjList.getNeighborsOf(3));
+    ASSERT_EQ(4, adjList.nodeDegree(1));
+    ASSERT_EQ(4, adjList.maxDegree());
+}
+
+TEST(AdjListTest, removeEdgesMatchesSingleRemovals) {
+    AdjList batched(lstFile);
+    AdjList single(lstFile);
+
+    std::vector<EdgeInfo> edges = {
+        {1, 2},
+        {3, 7},
+        {3, 4},
+        {5, 1}
+    };
+    batched.removeEdges(edges);
+    for (const auto& edge : edges)
+    {
+        single.removeEdge(edge);
+    }
+
+    for (auto node : single.getNodeIds())
+    {
+        ASSERT_EQ(single.getNeighborsOf(node), batched.getNeighborsOf(node));
+        ASSERT_EQ(single.nodeDegree(node), batched.nodeDegree(node));
+    }
+    ASSERT_EQ(std::vector<NodeId>({6}), batched.getNeighborsOf(1));
+    ASSERT_EQ(0, batched.nodeDegree(3));
+}
+
+TEST(AdjListTest, removeNodeTombstonesUntilCompact) {
+    AdjList adjList(lstFile);
+    adjList.setEdge({1, 5});
+
+    adjList.removeNode(6);
+    adjList.removeNode(5);
+
+    ASSERT_EQ(7, adjList.nodesAmount());
+    ASSERT_EQ(std::vector<NodeId>({2}), adjList.getNeighborsOf(1));
+    ASSERT_EQ(std::vector<NodeId>({9}), adjList.getNeighborsOf(8));
+    ASSERT_EQ(std::vector<NodeId>({7, 8}), adjList.getNeighborsOf(9));
+    ASSERT_FALSE(adjList.findEdge({1, 5}).weight.has_value());
+    // the one-way arc 1 -> 5 is still counted until compaction
+    ASSERT_EQ(2, adjList.nodeDegree(1));
+
+    adjList.compact();
+    ASSERT_EQ(1, adjList.nodeDegree(1));
+    ASSERT_EQ(std::vector<NodeId>({1, 2, 3, 4, 7, 8, 9}), adjList.getNodeIds());
+    ASSERT_EQ(std::vector<NodeId>({3, 4, 9}), adjList.getNeighborsOf(7));
+
+    adjList.addNodes(1);
+    adjList.setEdge({10, 1});
+    ASSERT_EQ(std::vector<NodeId>({1}), adjList.getNeighborsOf(10));
+}
+TEST(AdjListTest, removeNodeKeepsDegreesOfLeftoverBackArcs) {
+    AdjList adjList(lstFile);
+    auto degreeOf7 = adjList.nodeDegree(7);
+
+    adjList.removeNode(9);
+    ASSERT_EQ(degreeOf7 - 1, adjList.nodeDegree(7));
+    ASSERT_EQ(std::vector<NodeId>({3, 4}), adjList.getNeighborsOf(7));
+
+    // the dead arc 7 -> 9 still sits in the list, mutations must not count it
+    adjList.removeEdge({7, 3});
+    ASSERT_EQ(degreeOf7 - 2, adjList.nodeDegree(7));
+    std::vector<EdgeInfo> added = {
+        {7, 1}
+    };
+    adjList.setEdges(added);
+    ASSERT_EQ(degreeOf7 - 1, adjList.nodeDegree(7));
+
+    adjList.compact();
+    ASSERT_EQ(degreeOf7 - 1, adjList.nodeDegree(7));
+    ASSERT_EQ(std::vector<NodeId>({1, 4}), adjList.getNeighborsOf(7));
+}
+} // namespace Graphs
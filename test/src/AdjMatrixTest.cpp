@@ -1,4 +1,5 @@
 #include <Graphs/AdjMatrix.hpp>
+#include <Graphs/ColoringAlgorithms.hpp>
 #include <gtest/gtest.h>
 #include <string>
 
@@ -33,4 +34,53 @@ TEST(AdjMatrixTest, createFromGraphMLFile) {
     ASSERT_EQ(3, adjMatrix.nodeDegree(7));
     ASSERT_EQ(4, adjMatrix.nodeDegree(8));
 }
+
+TEST(AdjMatrixTest, degreesFollowMutations) {
+    AdjMatrix adjMatrix(matFile);
+    ASSERT_EQ(std::vector<uint32_t>({4, 2, 4, 0, 3, 1}), std::vector<uint32_t>(adjMatrix.degrees().begin(), adjMatrix.degrees().end()));
+    ASSERT_EQ(4, adjMatrix.maxDegree());
+
+    adjMatrix.setEdge({3, 0});
+    adjMatrix.setEdge({3, 0});
+    ASSERT_EQ(1, adjMatrix.nodeDegree(3));
+
+    adjMatrix.removeEdge({0, 1});
+    ASSERT_EQ(3, adjMatrix.nodeDegree(0));
+    ASSERT_EQ(4, adjMatrix.maxDegree());
+
+    adjMatrix.removeEdge({2, 0});
+    adjMatrix.removeEdge({2, 1});
+    ASSERT_EQ(3, adjMatrix.maxDegree());
+
+    adjMatrix.addNodes(2);
+    ASSERT_EQ(8, adjMatrix.degrees().size());
+    ASSERT_EQ(0, adjMatrix.nodeDegree(7));
+}
+
+TEST(AdjMatrixTest, removeNodeKeepsIdsThroughCompact) {
+    AdjMatrix adjMatrix(matFile);
+    adjMatrix.removeNode(2);
+
+    ASSERT_EQ(5, adjMatrix.nodesAmount());
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 3, 4, 5}), adjMatrix.getNodeIds());
+    ASSERT_EQ(3, adjMatrix.nodeDegree(0));
+    ASSERT_EQ(0, adjMatrix.nodeDegree(5));
+    ASSERT_FALSE(adjMatrix.findEdge({0, 2}).weight.has_value());
+
+    adjMatrix.compact();
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 3, 4, 5}), adjMatrix.getNodeIds());
+    ASSERT_EQ(std::vector<NodeId>({1, 3, 4}), adjMatrix.getNeighborsOf(0));
+    ASSERT_EQ(std::vector<NodeId>({1, 3, 5}), adjMatrix.getNeighborsOf(4));
+    ASSERT_EQ(5u, adjMatrix.findEdge({4, 5}).weight.value());
+
+    adjMatrix.addNodes(1);
+    adjMatrix.setEdge({6, 5});
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 3, 4, 5, 6}), adjMatrix.getNodeIds());
+    ASSERT_EQ(1, adjMatrix.nodeDegree(6));
+}
+
+TEST(AdjMatrixTest, largestFirstOrder) {
+    AdjMatrix adjMatrix(matFile);
+    ASSERT_EQ(Algorithm::Permutation({0, 2, 4, 1, 5, 3}), Algorithm::largestFirstOrder(adjMatrix));
+}
 } // namespace Graphs
@@ -0,0 +1,94 @@
+#include <Graphs/AdjList.hpp>
+#include <Graphs/BreadthFirstSearch.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string bfsListFile = "../test/sample/adjList.lst";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+void expectValidTree(const CsrGraph& graph, const BfsResult& result, NodeId source) {
+    ASSERT_EQ(0, result.levels[source]);
+    ASSERT_EQ(source, result.parents[source]);
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        if (node == source or not result.reached(node))
+        {
+            continue;
+        }
+        auto parent = result.parents[node];
+        ASSERT_EQ(result.levels[parent] + 1, result.levels[node]);
+        ASSERT_TRUE(graph.findEdge({parent, node}).weight.has_value());
+    }
+}
+} // namespace
+
+TEST(BreadthFirstSearchTest, queueFollowsOutgoingEdges) {
+    std::vector<EdgeInfo> edges = {{0, 1}, {1, 2}, {2, 0}, {0, 3}, {4, 0}};
+    CsrGraph graph(5, edges);
+    auto result = std::make_shared<BfsResult>();
+
+    BreadthFirstSearch{result, 0}(graph);
+
+    ASSERT_EQ(std::vector<uint32_t>({0, 1, 2, 1, BfsResult::unreached}), result->levels);
+    ASSERT_EQ(std::vector<NodeId>({0, 0, 1, 0, BfsResult::noParent}), result->parents);
+}
+
+TEST(BreadthFirstSearchTest, keepsNodeIdsOfSourceGraph) {
+    AdjList graph(bfsListFile);
+    auto result = std::make_shared<BfsResult>();
+
+    BreadthFirstSearch{result, 1}(graph);
+
+    ASSERT_EQ(10, result->levels.size());
+    ASSERT_FALSE(result->reached(0));
+    ASSERT_EQ(0, result->levels[1]);
+    for (auto neighbor : graph.getNeighborsOf(1))
+    {
+        ASSERT_EQ(1, result->levels[neighbor]);
+    }
+    ASSERT_THROW(BreadthFirstSearch(result, 0)(graph), std::out_of_range);
+}
+
+TEST(BreadthFirstSearchTest, directionOptimizingMatchesQueueLevels) {
+    auto graph = Generators::rmat({.scale = 14, .edgeFactor = 16, .seed = 3});
+    auto expected = std::make_shared<BfsResult>();
+    auto actual = std::make_shared<BfsResult>();
+
+    for (NodeId source : {0u, 77u, 4095u})
+    {
+        BreadthFirstSearch{expected, source}(graph);
+        for (uint32_t threads : {1u, 4u})
+        {
+            BreadthFirstSearch{actual, source, BreadthFirstSearch::Method::directionOptimizing, threads}(graph);
+            ASSERT_EQ(expected->levels, actual->levels);
+            expectValidTree(graph, *actual, source);
+        }
+    }
+}
+
+TEST(BreadthFirstSearchTest, directionOptimizingHandlesDirectedGraphs) {
+    std::vector<EdgeInfo> edges;
+    for (NodeId node = 0; node < 2000; node++)
+    {
+        edges.push_back({node, (node * 31 + 7) % 2000});
+        edges.push_back({node, (node + 1) % 2000});
+        edges.push_back({(node * 17) % 2000, node});
+    }
+    CsrGraph graph(2000, edges);
+    auto expected = std::make_shared<BfsResult>();
+    auto actual = std::make_shared<BfsResult>();
+
+    BreadthFirstSearch{expected, 5}(graph);
+    BreadthFirstSearch{actual, 5, BreadthFirstSearch::Method::directionOptimizing, 3}(graph);
+
+    ASSERT_EQ(expected->levels, actual->levels);
+    expectValidTree(graph, *actual, 5);
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/Centrality.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <string>
+
+using namespace testing;
+
+const std::string centralitySspFile = "../BenchmarkSamples/SSP_test/graph_10.mat";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+/* Betweenness straight from the definition, with all-pairs distances and path counts */
+std::vector<double> bruteForceBetweenness(const Graph& graph) {
+    constexpr uint64_t infinite = std::numeric_limits<uint64_t>::max() / 4;
+    const auto nodesCount = graph.nodesAmount();
+
+    std::vector<std::vector<uint64_t>> distances(nodesCount, std::vector<uint64_t>(nodesCount, infinite));
+    for (NodeId u = 0; u < nodesCount; u++)
+    {
+        distances[u][u] = 0;
+        for (auto v : graph.getNeighborsOf(u))
+        {
+            distances[u][v] = std::min<uint64_t>(distances[u][v], graph.findEdge({u, v}).weight.value());
+        }
+    }
+    for (NodeId k = 0; k < nodesCount; k++)
+    {
+        for (NodeId u = 0; u < nodesCount; u++)
+        {
+            for (NodeId v = 0; v < nodesCount; v++)
+            {
+                distances[u][v] = std::min(distances[u][v], distances[u][k] + distances[k][v]);
+            }
+        }
+    }
+
+    std::vector<std::vector<double>> paths(nodesCount, std::vector<double>(nodesCount, 0));
+    for (NodeId s = 0; s < nodesCount; s++)
+    {
+        std::vector<NodeId> order(nodesCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::ranges::sort(order, {}, [&](NodeId node) {
+            return distances[s][node];
+        });
+        paths[s][s] = 1;
+        for (auto v : order)
+        {
+            for (NodeId u = 0; u < nodesCount; u++)
+            {
+                auto edge = graph.findEdge({u, v}).weight;
+                if (u != v and edge.has_value() and distances[s][u] + edge.value() == distances[s][v])
+                {
+                    paths[s][v] += paths[s][u];
+                }
+            }
+        }
+    }
+
+    std::vector<double> betweenness(nodesCount, 0);
+    for (NodeId s = 0; s < nodesCount; s++)
+    {
+        for (NodeId t = 0; t < nodesCount; t++)
+        {
+            for (NodeId v = 0; v < nodesCount; v++)
+            {
+                if (s != t and s != v and v != t and distances[s][t] < infinite
+                    and distances[s][v] + distances[v][t] == distances[s][t])
+                {
+                    betweenness[v] += paths[s][v] * paths[v][t] / paths[s][t];
+                }
+            }
+        }
+    }
+    return betweenness;
+}
+} // namespace
+
+TEST(CentralityTest, pathGraph) {
+    std::vector<EdgeInfo> edges = {{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 3}, {3, 2}};
+    CsrGraph graph(4, edges);
+    auto result = std::make_shared<CentralityResult>();
+
+    Centrality{result}(graph);
+
+    ASSERT_EQ(std::vector<double>({0, 4, 4, 0}), result->betweenness);
+    ASSERT_DOUBLE_EQ((1 + 1.0 / 2 + 1.0 / 3) / 3, result->closeness[0]);
+    ASSERT_DOUBLE_EQ((1 + 1 + 1.0 / 2) / 3, result->closeness[1]);
+    ASSERT_EQ(4, result->sourcesAmount);
+    ASSERT_EQ(0, result->betweennessError);
+}
+
+TEST(CentralityTest, weightedBetweennessMatchesDefinition) {
+    AdjMatrix graph(centralitySspFile);
+    auto expected = bruteForceBetweenness(graph);
+    auto result = std::make_shared<CentralityResult>();
+
+    for (uint32_t threads : {1u, 3u})
+    {
+        Centrality{result, threads}(graph);
+        ASSERT_EQ(expected.size(), result->betweenness.size());
+        for (std::size_t node = 0; node < expected.size(); node++)
+        {
+            ASSERT_NEAR(expected[node], result->betweenness[node], 1e-9);
+        }
+    }
+}
+
+TEST(CentralityTest, samplingStaysWithinErrorBounds) {
+    auto graph = Generators::rmat({.scale = 9, .edgeFactor = 4, .seed = 2});
+    auto exact = std::make_shared<CentralityResult>();
+    auto sampled = std::make_shared<CentralityResult>();
+
+    Centrality{exact, 2}(graph);
+    CentralitySampling sampling{.epsilon = 0.1, .delta = 0.1, .seed = 4};
+    Centrality{sampled, 2, sampling}(graph);
+
+    ASSERT_EQ(Centrality::samplesAmount(512, sampling), sampled->sourcesAmount);
+    ASSERT_LT(sampled->sourcesAmount, 512);
+    ASSERT_GT(sampled->betweennessError, 0);
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        ASSERT_NEAR(exact->betweenness[node], sampled->betweenness[node], sampled->betweennessError);
+        ASSERT_NEAR(exact->closeness[node], sampled->closeness[node], sampled->closenessError);
+    }
+}
+
+TEST(CentralityTest, rejectsZeroWeightsAndBadSampling) {
+    std::vector<EdgeInfo> edges = {{0, 1, 0}, {1, 0, 2}};
+    CsrGraph graph(2, edges);
+    auto result = std::make_shared<CentralityResult>();
+
+    ASSERT_THROW(Centrality{result}(graph), std::invalid_argument);
+    ASSERT_THROW(Centrality(result, 1, CentralitySampling{.epsilon = 0}), std::invalid_argument);
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,84 @@
+#include <Graphs/AdjList.hpp>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/CompressedGraph.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+using namespace testing;
+
+const std::string coloringLstFile = "../test/sample/adjList.lst";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+void expectProperColoring(const Graph& graph, const ColoringResult& coloring) {
+    ASSERT_EQ(graph.nodesAmount(), coloring.size());
+
+    std::unordered_map<NodeId, ColorId> colors;
+    for (const auto& [node, color] : coloring)
+    {
+        ASSERT_TRUE(colors.emplace(node, color).second) << "node " << node << " colored twice";
+    }
+    for (const auto& [node, color] : coloring)
+    {
+        for (auto neighbor : graph.getNeighborsOf(node))
+        {
+            if (neighbor != node)
+            {
+                ASSERT_NE(color, colors.at(neighbor)) << "edge " << node << " - " << neighbor;
+            }
+        }
+    }
+}
+} // namespace
+
+static_assert(StaticGraph<CsrGraph>);
+static_assert(StaticGraph<CompressedGraph>);
+static_assert(not StaticGraph<AdjList>);
+
+TEST(ColoringAlgorithmsTest, staticPathColorsProperly) {
+    auto planted = Generators::plantedColoring({.nodesCount = 2000, .chromaticNumber = 6, .interPartProbability = 0.02, .seed = 4});
+    auto result = std::make_shared<ColoringResult>();
+
+    GreedyColoring<notVerbose>{result}(planted.graph);
+
+    expectProperColoring(planted.graph, *result);
+    ColorId colors = 0;
+    for (const auto& [node, color] : *result)
+    {
+        colors = std::max(colors, color + 1);
+    }
+    ASSERT_GE(colors, 6);
+}
+
+TEST(ColoringAlgorithmsTest, interfacePathMatchesEveryBackend) {
+    AdjList adjList(coloringLstFile);
+    CsrGraph csrGraph(coloringLstFile);
+    CompressedGraph compressedGraph(csrGraph);
+    auto result = std::make_shared<ColoringResult>();
+
+    for (const Graph* graph : {static_cast<const Graph*>(&adjList), static_cast<const Graph*>(&csrGraph),
+                               static_cast<const Graph*>(&compressedGraph)})
+    {
+        GreedyColoring<notVerbose>{result}(*graph);
+        expectProperColoring(*graph, *result);
+    }
+}
+
+TEST(ColoringAlgorithmsTest, verboseStaticCallLogsThroughInterface) {
+    CsrGraph csrGraph(coloringLstFile);
+    auto result = std::make_shared<ColoringResult>();
+    std::stringstream log;
+
+    GreedyColoring<verbose>{result, log}(csrGraph);
+
+    expectProperColoring(csrGraph, *result);
+    ASSERT_NE(std::string::npos, log.str().find("Greedy coloring completed"));
+}
+} // namespace Graphs::Algorithm
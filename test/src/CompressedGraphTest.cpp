@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <Graphs/AdjList.hpp>
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/BreadthFirstSearch.hpp>
+#include <Graphs/CompressedGraph.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string compressedLstFile = "../test/sample/adjList.lst";
+const std::string compressedMatrixFile = "../BenchmarkSamples/SSP_test/graph_100.mat";
+
+namespace Graphs
+{
+namespace
+{
+void expectSameRows(const CsrGraph& expected, const CompressedGraph& compressed) {
+    ASSERT_EQ(expected.nodesAmount(), compressed.nodesAmount());
+    ASSERT_EQ(expected.edgesAmount(), compressed.edgesAmount());
+    ASSERT_EQ(expected.isWeighted(), compressed.isWeighted());
+
+    std::vector<NodeId> neighbors;
+    std::vector<uint32_t> weights;
+    for (NodeId node = 0; node < expected.nodesAmount(); node++)
+    {
+        ASSERT_EQ(expected.nodeDegree(node), compressed.nodeDegree(node));
+        ASSERT_EQ(expected.originalId(node), compressed.originalId(node));
+        auto decoded = compressed.decodeNeighbors(node, neighbors);
+        ASSERT_TRUE(std::ranges::equal(expected.neighbors(node), decoded)) << "node " << node;
+        auto decodedWeights = compressed.decodeWeights(node, weights);
+        ASSERT_TRUE(std::ranges::equal(expected.weights(node), decodedWeights)) << "node " << node;
+    }
+}
+} // namespace
+
+TEST(CompressedGraphTest, decodesRowsOfLstFile) {
+    CsrGraph csrGraph(compressedLstFile);
+    CompressedGraph compressed(csrGraph);
+
+    expectSameRows(csrGraph, compressed);
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 7}), compressed.getNeighborsOf(5));
+    ASSERT_TRUE(compressed.findEdge({0, 5}).weight.has_value());
+    ASSERT_FALSE(compressed.findEdge({0, 2}).weight.has_value());
+}
+
+TEST(CompressedGraphTest, keepsWeightsAndOriginalIds) {
+    AdjMatrix matrix(compressedMatrixFile);
+    CsrGraph csrGraph(matrix);
+    CompressedGraph compressed(matrix);
+
+    expectSameRows(csrGraph, compressed);
+    ASSERT_EQ(matrix.findEdge({3, 7}).weight, compressed.findEdge({3, 7}).weight);
+
+    AdjList adjList(compressedLstFile);
+    CompressedGraph fromAdjList(adjList);
+    ASSERT_EQ(1, fromAdjList.originalId(0));
+    expectSameRows(CsrGraph(adjList), fromAdjList);
+}
+
+TEST(CompressedGraphTest, codecRoundTripsValuesOfAllLengths) {
+    std::vector<uint32_t> values = {0, 255, 256, 65535, 65536, (1u << 24) - 1, 1u << 24, 0xFFFFFFFF, 7};
+    std::vector<uint8_t> bytes = {42};
+    StreamVByte::encode(values, bytes);
+    ASSERT_EQ(1 + 3 + 1 + 1 + 2 + 2 + 3 + 3 + 4 + 4 + 1, bytes.size());
+    bytes.resize(bytes.size() + StreamVByte::padding);
+
+    std::vector<uint32_t> decoded;
+    auto end = StreamVByte::decode(bytes.data() + 1, static_cast<uint32_t>(values.size()), [&decoded](uint32_t value) {
+        decoded.push_back(value);
+    });
+
+    ASSERT_EQ(values, decoded);
+    ASSERT_EQ(end, StreamVByte::skip(bytes.data() + 1, static_cast<uint32_t>(values.size())));
+    ASSERT_EQ(end, bytes.data() + bytes.size() - StreamVByte::padding);
+}
+
+TEST(CompressedGraphTest, encodesNeighborsBelowAndAboveNode) {
+    std::vector<EdgeInfo> edges = {
+        {900, 0, 1}, {900, 200, 70000}, {900, 899, 1u << 30}, {900, 900, 4}, {5, 901, 255}, {0, 901, 256}
+    };
+    CsrGraph csrGraph(902, edges);
+    CompressedGraph compressed(csrGraph);
+
+    expectSameRows(csrGraph, compressed);
+    ASSERT_EQ(70000u, compressed.findEdge({900, 200}).weight.value());
+}
+
+TEST(CompressedGraphTest, convertsBackToCsr) {
+    auto graph = Generators::rmat({.scale = 10, .seed = 3});
+    graph.metadata()["name"] = "rmat";
+    CompressedGraph compressed(graph);
+
+    auto decompressed = compressed.toCsr();
+
+    expectSameRows(decompressed, compressed);
+    ASSERT_EQ("rmat", decompressed.metadata().at("name"));
+    ASSERT_LT(compressed.memoryUsage(), graph.memoryUsage());
+}
+
+TEST(CompressedGraphTest, traversesInPlaceLikeCsr) {
+    auto graph = Generators::rmat({.scale = 12, .seed = 5});
+    CompressedGraph compressed(graph);
+    auto expected = std::make_shared<Algorithm::BfsResult>();
+    auto result = std::make_shared<Algorithm::BfsResult>();
+
+    Algorithm::BreadthFirstSearch{expected, 0}(graph);
+    Algorithm::BreadthFirstSearch{result, 0}(compressed);
+
+    ASSERT_EQ(expected->levels, result->levels);
+    ASSERT_EQ(expected->parents, result->parents);
+}
+
+TEST(CompressedGraphTest, mutationThrows) {
+    CsrGraph csrGraph(compressedLstFile);
+    CompressedGraph compressed(csrGraph);
+    ASSERT_THROW(compressed.setEdge({0, 2}), std::logic_error);
+    ASSERT_THROW(compressed.removeNode(0), std::logic_error);
+}
+} // namespace Graphs
@@ -0,0 +1,79 @@
+#include <Graphs/ConnectedComponents.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string componentsMapFile = "../test/sample/pixelMap.txt";
+
+namespace Graphs::Algorithm
+{
+TEST(ConnectedComponentsTest, labelsGraphComponents) {
+    std::vector<EdgeInfo> edges = {
+        {0, 1},
+        {1, 2},
+        {3, 4},
+        {6, 5}
+    };
+    CsrGraph graph(7, edges);
+
+    auto result = std::make_shared<ComponentLabels>();
+    ConnectedComponents{result}(graph);
+
+    ASSERT_EQ(3, result->componentsAmount());
+    ASSERT_EQ(std::vector<uint32_t>({3, 2, 2}), result->sizes);
+    ASSERT_TRUE(result->connected(0, 2));
+    ASSERT_TRUE(result->connected(5, 6));
+    ASSERT_FALSE(result->connected(2, 3));
+    ASSERT_FALSE(result->connected(0, 100));
+}
+
+TEST(ConnectedComponentsTest, parallelMatchesUnionFind) {
+    auto planted = Generators::plantedColoring({.nodesCount = 20000, .chromaticNumber = 2, .interPartProbability = 0.00008, .seed = 4});
+
+    auto sequential = std::make_shared<ComponentLabels>();
+    auto parallel = std::make_shared<ComponentLabels>();
+    ConnectedComponents{sequential}(planted.graph);
+    ConnectedComponents{parallel, ConnectedComponents::Method::parallel, 4}(planted.graph);
+
+    ASSERT_GT(sequential->componentsAmount(), 1);
+    ASSERT_EQ(sequential->labels, parallel->labels);
+    ASSERT_EQ(sequential->sizes, parallel->sizes);
+}
+
+TEST(ConnectedComponentsTest, pixelMapRunsMatchGridGraph) {
+    Data::Pixel_map map(componentsMapFile);
+    GridGraph grid(map);
+
+    auto fromRuns = std::make_shared<ComponentLabels>();
+    auto fromGraph = std::make_shared<ComponentLabels>();
+    ConnectedComponents{fromRuns}(map);
+    ConnectedComponents{fromGraph}(grid);
+
+    ASSERT_EQ(fromGraph->componentsAmount(), fromRuns->componentsAmount());
+    for (NodeId lhs : grid.getNodeIds())
+    {
+        for (NodeId rhs : grid.getNodeIds())
+        {
+            ASSERT_EQ(fromGraph->connected(lhs, rhs), fromRuns->connected(lhs, rhs));
+        }
+    }
+    ASSERT_EQ(ComponentLabels::noComponent, fromRuns->componentOf(0));
+}
+
+TEST(ConnectedComponentsTest, eightConnectivityJoinsDiagonalPixels) {
+    Data::Pixel_map map(componentsMapFile);
+
+    auto four = std::make_shared<ComponentLabels>();
+    auto eight = std::make_shared<ComponentLabels>();
+    ConnectedComponents{four}(map);
+    ConnectedComponents{eight}(map, GridGraph::Connectivity::eight);
+
+    ASSERT_EQ(4, four->componentsAmount());
+    ASSERT_EQ(2, eight->componentsAmount());
+    // (2, 9) touches (3, 7) only through the corner of (2, 8) / (3, 8)
+    ASSERT_FALSE(four->connected(29, 37));
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,47 @@
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/CoreDecomposition.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace Graphs::Algorithm
+{
+TEST(CoreDecompositionTest, cliqueWithTail) {
+    std::vector<EdgeInfo> edges = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {3, 4}, {4, 5}, {6, 6}};
+    CsrGraph graph(7, edges);
+    auto result = std::make_shared<CoreResult>();
+
+    CoreDecomposition{result}(graph);
+
+    ASSERT_EQ(std::vector<uint32_t>({3, 3, 3, 3, 1, 1, 0}), result->coreNumbers);
+    ASSERT_EQ(3, result->degeneracy);
+    ASSERT_EQ(6, result->removalOrder.front());
+}
+
+TEST(CoreDecompositionTest, smallestLastOrderBoundsBackNeighbors) {
+    auto graph = Generators::rmat({.scale = 10, .edgeFactor = 8, .seed = 8});
+    auto result = std::make_shared<CoreResult>();
+    CoreDecomposition{result}(graph);
+
+    auto order = smallestLastOrder(graph);
+    ASSERT_EQ(graph.nodesAmount(), order.size());
+
+    std::vector<uint32_t> positions(graph.nodesAmount());
+    for (uint32_t i = 0; i < order.size(); i++)
+    {
+        positions[order[i]] = i;
+    }
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        uint32_t earlierNeighbors = 0;
+        for (auto neighbor : graph.neighbors(node))
+        {
+            earlierNeighbors += positions[neighbor] < positions[node] ? 1 : 0;
+        }
+        ASSERT_LE(earlierNeighbors, result->degeneracy);
+        ASSERT_LE(result->coreNumbers[node], graph.nodeDegree(node));
+    }
+}
+} // namespace Graphs::Algorithm
@@ -0,0 +1,94 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <Graphs/AdjList.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string lstFile = "../test/sample/adjList.lst";
+
+namespace Graphs
+{
+TEST(CsrGraphTest, createFromLstFile) {
+    CsrGraph csrGraph(lstFile);
+    ASSERT_EQ(9, csrGraph.nodesAmount());
+    ASSERT_EQ(22, csrGraph.edgesAmount());
+    ASSERT_EQ(2, csrGraph.nodeDegree(0));
+    ASSERT_EQ(3, csrGraph.nodeDegree(5));
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 7}), csrGraph.getNeighborsOf(5));
+    ASSERT_TRUE(csrGraph.findEdge({0, 5}).weight.has_value());
+    ASSERT_FALSE(csrGraph.findEdge({0, 2}).weight.has_value());
+}
+
+TEST(CsrGraphTest, createFromAdjList) {
+    AdjList adjList(lstFile);
+    CsrGraph csrGraph(adjList);
+    ASSERT_EQ(adjList.nodesAmount(), csrGraph.nodesAmount());
+    ASSERT_EQ(1, csrGraph.originalId(0));
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 7}), csrGraph.getNeighborsOf(5));
+}
+
+TEST(CsrGraphTest, binaryFileRoundTrip) {
+    auto path = (std::filesystem::temp_directory_path() / "CsrGraphTest.csr").string();
+
+    std::vector<EdgeInfo> edges = {
+        {0, 1, 4},
+        {1, 0, 4},
+        {1, 2, 7},
+        {2, 1, 7}
+    };
+    CsrGraph original(3, edges);
+    original.metadata()["name"] = "path";
+    original.save(path);
+
+    CsrGraph loaded(path);
+    std::filesystem::remove(path);
+
+    ASSERT_TRUE(loaded.isWeighted());
+    ASSERT_EQ(4, loaded.edgesAmount());
+    ASSERT_EQ("path", loaded.metadata().at("name"));
+    ASSERT_EQ(7, loaded.findEdge({2, 1}).weight.value());
+}
+
+TEST(CsrGraphTest, corruptBinaryFileThrows) {
+    auto path = (std::filesystem::temp_directory_path() / "CsrGraphTest.csr").string();
+    auto corrupt = [&](std::streamoff position, uint64_t value, std::size_t size) {
+        std::vector<EdgeInfo> edges = {
+            {0, 1},
+            {1, 2}
+        };
+        CsrGraph(3, edges).save(path);
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(position, position < 0 ? std::ios::end : std::ios::beg);
+        file.write(reinterpret_cast<const char*>(&value), static_cast<std::streamsize>(size));
+    };
+
+    // header is magic, version, flags, nodes count, entries count, metadata count
+    corrupt(16, uint64_t{1} << 40, sizeof(uint64_t));
+    ASSERT_THROW(CsrGraph{path}, std::runtime_error);
+    corrupt(24, uint64_t{1} << 40, sizeof(uint64_t));
+    ASSERT_THROW(CsrGraph{path}, std::runtime_error);
+    corrupt(32 + 2 * sizeof(uint64_t), 0, sizeof(uint64_t));
+    ASSERT_THROW(CsrGraph{path}, std::runtime_error);
+    corrupt(-static_cast<std::streamoff>(sizeof(NodeId)), 3, sizeof(NodeId));
+    ASSERT_THROW(CsrGraph{path}, std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST(CsrGraphTest, overflowingLstIdThrows) {
+    auto path = (std::filesystem::temp_directory_path() / "CsrGraphTest.lst").string();
+    std::ofstream(path) << "1: 4294967297\n";
+
+    ASSERT_THROW(CsrGraph{path}, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(CsrGraphTest, mutationThrows) {
+    CsrGraph csrGraph(lstFile);
+    ASSERT_THROW(csrGraph.setEdge({0, 2}), std::logic_error);
+}
+} // namespace Graphs
@@ -0,0 +1,107 @@
+#include <Graphs/AdjList.hpp>
+#include <Graphs/DynamicGraph.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <string>
+
+using namespace testing;
+
+const std::string dynamicListFile = "../test/sample/adjList.lst";
+
+namespace Graphs
+{
+TEST(DynamicGraphTest, setFindAndRemoveEdges) {
+    DynamicGraph graph(4);
+    graph.setEdge({0, 1});
+    graph.setEdge({0, 2, 7});
+    graph.setEdge({0, 1, 3});
+    graph.setEdge({2, 2});
+
+    ASSERT_EQ(3, graph.edgesAmount());
+    ASSERT_EQ(2, graph.nodeDegree(0));
+    ASSERT_EQ(3u, graph.findEdge({0, 1}).weight.value());
+    ASSERT_EQ(7u, graph.findEdge({0, 2}).weight.value());
+    ASSERT_FALSE(graph.findEdge({1, 0}).weight.has_value());
+    ASSERT_EQ(std::vector<NodeId>({1, 2}), graph.getNeighborsOf(0));
+
+    graph.removeEdge({0, 1});
+    graph.removeEdge({0, 3});
+    ASSERT_EQ(2, graph.edgesAmount());
+    ASSERT_FALSE(graph.findEdge({0, 1}).weight.has_value());
+}
+
+TEST(DynamicGraphTest, removeNodeDropsIncomingArcs) {
+    DynamicGraph graph(4);
+    graph.setEdge({0, 1});
+    graph.setEdge({2, 1});
+    graph.setEdge({1, 3});
+    graph.setEdge({1, 1});
+
+    graph.removeNode(1);
+    ASSERT_EQ(3, graph.nodesAmount());
+    ASSERT_EQ(0, graph.edgesAmount());
+    ASSERT_EQ(std::vector<NodeId>({0, 2, 3}), graph.getNodeIds());
+    ASSERT_TRUE(graph.getNeighborsOf(0).empty());
+
+    graph.addNodes(1);
+    graph.setEdge({4, 0});
+    ASSERT_EQ(std::vector<NodeId>({0}), graph.getNeighborsOf(4));
+}
+
+TEST(DynamicGraphTest, churnMatchesReferenceSet) {
+    constexpr uint32_t nodesCount = 64;
+    DynamicGraph graph(nodesCount);
+    std::set<std::pair<NodeId, NodeId>> reference;
+
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<NodeId> node(0, nodesCount - 1);
+    for (uint32_t i = 0; i < 50000; i++)
+    {
+        EdgeInfo edge{node(generator), node(generator), std::nullopt};
+        if (generator() % 3 == 0)
+        {
+            graph.removeEdge(edge);
+            reference.erase({edge.source, edge.destination});
+        }
+        else
+        {
+            graph.setEdge(edge);
+            reference.insert({edge.source, edge.destination});
+        }
+    }
+
+    ASSERT_EQ(reference.size(), graph.edgesAmount());
+    for (NodeId source = 0; source < nodesCount; source++)
+    {
+        for (NodeId destination = 0; destination < nodesCount; destination++)
+        {
+            ASSERT_EQ(reference.contains({source, destination}), graph.findEdge({source, destination}).weight.has_value());
+        }
+    }
+}
+
+TEST(DynamicGraphTest, exportsCsrSnapshot) {
+    AdjList adjList(dynamicListFile);
+    DynamicGraph graph(adjList);
+    ASSERT_EQ(adjList.getNodeIds(), graph.getNodeIds());
+
+    graph.removeNode(6);
+    graph.setEdge({1, 9, 4});
+    auto snapshot = graph.toCsr();
+
+    ASSERT_EQ(8, snapshot.nodesAmount());
+    ASSERT_EQ(graph.edgesAmount(), snapshot.edgesAmount());
+    ASSERT_TRUE(snapshot.isWeighted());
+    for (NodeId node = 0; node < snapshot.nodesAmount(); node++)
+    {
+        std::vector<NodeId> neighbors;
+        for (auto neighbor : snapshot.neighbors(node))
+        {
+            neighbors.push_back(snapshot.originalId(neighbor));
+        }
+        ASSERT_EQ(graph.getNeighborsOf(snapshot.originalId(node)), neighbors);
+    }
+    ASSERT_EQ(4u, snapshot.findEdge({0, 7}).weight.value());
+}
+} // namespace Graphs
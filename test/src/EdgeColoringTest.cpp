@@ -0,0 +1,70 @@
+#include <Graphs/AdjList.hpp>
+#include <Graphs/EdgeColoring.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string edgeColoringListFile = "../test/sample/adjList.lst";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+void expectProperEdgeColoring(const EdgeIndex& index, const EdgeColoringResult& result) {
+    ASSERT_EQ(index.edgesAmount(), result.colors.size());
+    for (NodeId node = 0; node < index.nodesAmount(); node++)
+    {
+        std::vector<bool> used(result.colorsAmount(), false);
+        for (auto edge : index.incidentEdges(node))
+        {
+            auto color = result.colors[edge];
+            ASSERT_NE(EdgeColoringResult::noColor, color);
+            ASSERT_FALSE(used[color]);
+            used[color] = true;
+        }
+    }
+}
+} // namespace
+
+TEST(EdgeColoringTest, misraGriesFitsInMaxDegreePlusOne) {
+    auto planted = Generators::plantedColoring({.nodesCount = 2000, .chromaticNumber = 8, .interPartProbability = 0.01, .seed = 3});
+    EdgeIndex index(planted.graph);
+
+    auto result = std::make_shared<EdgeColoringResult>();
+    EdgeColoring{result}(index);
+
+    expectProperEdgeColoring(index, *result);
+    ASSERT_LE(result->colorsAmount(), index.maxDegree() + 1);
+    ASSERT_GT(result->workingMemory, index.memoryUsage());
+}
+
+TEST(EdgeColoringTest, lineGraphColoringIsProper) {
+    AdjList list(edgeColoringListFile);
+    EdgeIndex index(list);
+
+    auto result = std::make_shared<EdgeColoringResult>();
+    EdgeColoring{result, EdgeColoring::Method::lineGraph}(list);
+
+    expectProperEdgeColoring(index, *result);
+    ASSERT_LE(result->colorsAmount(), 2 * index.maxDegree() - 1);
+}
+
+TEST(EdgeColoringTest, oddCycleNeedsThreeColors) {
+    std::vector<EdgeInfo> edges = {
+        {0, 1},
+        {1, 2},
+        {2, 3},
+        {3, 4},
+        {4, 0}
+    };
+    CsrGraph graph(5, edges);
+
+    auto result = std::make_shared<EdgeColoringResult>();
+    EdgeColoring{result}(graph);
+
+    expectProperEdgeColoring(EdgeIndex(graph), *result);
+    ASSERT_EQ(3, result->colorsAmount());
+}
+} // namespace Graphs::Algorithm
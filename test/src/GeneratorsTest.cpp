@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <filesystem>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/Generators.hpp>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace Graphs::Generators
+{
+TEST(GeneratorsTest, plantedPartitionIsProperColoring) {
+    auto planted = plantedColoring({.nodesCount = 500, .chromaticNumber = 5, .interPartProbability = 0.3, .seed = 7});
+    const auto& graph = planted.graph;
+
+    ASSERT_EQ(500, graph.nodesAmount());
+    ASSERT_EQ(5, knownChromaticNumber(graph));
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        for (auto neighbor : graph.neighbors(node))
+        {
+            ASSERT_NE(planted.partition[node], planted.partition[neighbor]);
+            ASSERT_TRUE(graph.findEdge({neighbor, node}).weight.has_value());
+        }
+    }
+}
+
+TEST(GeneratorsTest, plantedCliqueBoundsChromaticNumber) {
+    auto planted = plantedColoring({.nodesCount = 40, .chromaticNumber = 6, .interPartProbability = 0.0, .seed = 1});
+    const auto& graph = planted.graph;
+
+    ASSERT_EQ(6 * 5, graph.edgesAmount());
+
+    auto result = std::make_shared<Algorithm::ColoringResult>();
+    Algorithm::GreedyColoring<Algorithm::notVerbose>{result}(graph);
+    auto colors = std::ranges::max(*result, {}, [](const auto& coloring) {
+                      return coloring.second;
+                  }).second
+                + 1;
+    ASSERT_EQ(6, colors);
+}
+
+TEST(GeneratorsTest, metadataSurvivesLstFile) {
+    auto path = (std::filesystem::temp_directory_path() / "GeneratorsTest.lst").string();
+    auto planted = plantedColoring({.nodesCount = 50, .chromaticNumber = 3, .interPartProbability = 0.5, .seed = 3});
+    planted.graph.save(path);
+
+    CsrGraph loaded(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(3, knownChromaticNumber(loaded));
+    ASSERT_EQ(planted.graph.edgesAmount(), loaded.edgesAmount());
+}
+
+TEST(GeneratorsTest, tooFewNodesThrows) {
+    ASSERT_THROW(plantedColoring({.nodesCount = 2, .chromaticNumber = 3, .interPartProbability = 1.0}),
+                 std::invalid_argument);
+}
+
+TEST(GeneratorsTest, rmatIsSymmetricAndSimple) {
+    auto graph = rmat({.scale = 10, .edgeFactor = 8, .seed = 5});
+
+    ASSERT_EQ(1024, graph.nodesAmount());
+    ASSERT_GT(graph.edgesAmount(), 1024 * 8);
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        auto neighbors = graph.neighbors(node);
+        ASSERT_TRUE(std::ranges::adjacent_find(neighbors) == neighbors.end());
+        for (auto neighbor : neighbors)
+        {
+            ASSERT_NE(node, neighbor);
+            ASSERT_TRUE(graph.findEdge({neighbor, node}).weight.has_value());
+        }
+    }
+    ASSERT_THROW(rmat({.scale = 0}), std::invalid_argument);
+}
+} // namespace Graphs::Generators
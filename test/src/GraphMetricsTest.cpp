@@ -0,0 +1,57 @@
+#include <cmath>
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <Graphs/GraphMetrics.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string metricsMatFile = "../test/sample/adjMat.mat";
+
+namespace Graphs::Metrics
+{
+TEST(GraphMetricsTest, starIndices) {
+    std::vector<EdgeInfo> edges = {
+        {0, 1},
+        {0, 2},
+        {0, 3}
+    };
+    CsrGraph graph(4, edges);
+    DegreeMetrics metrics(graph);
+    const auto& indices = metrics.indices();
+
+    ASSERT_EQ(std::vector<uint32_t>({3, 1, 1, 1}), std::vector<uint32_t>(metrics.degrees().begin(), metrics.degrees().end()));
+    ASSERT_NEAR(4 * std::sqrt(2.0), indices.estrada, 1e-5);
+    ASSERT_NEAR(std::sqrt(3.0), indices.randic, 1e-5);
+    ASSERT_EQ(12, indices.firstZagreb);
+    ASSERT_EQ(9, indices.secondZagreb);
+    ASSERT_NEAR(3 * std::sqrt(2.0 / 3.0), indices.atomBondConnectivity, 1e-5);
+}
+
+TEST(GraphMetricsTest, recomputesAfterMutation) {
+    AdjMatrix adjMatrix(metricsMatFile);
+    DegreeMetrics metrics(adjMatrix);
+
+    ASSERT_EQ(84, metrics.indices().firstZagreb);
+    ASSERT_EQ(84, metrics.indices().firstZagreb);
+
+    adjMatrix.setEdge({3, 5});
+    ASSERT_EQ(98, metrics.indices().firstZagreb);
+    ASSERT_EQ(5, metrics.degrees()[3]);
+}
+
+TEST(GraphMetricsTest, parallelMatchesSingleThread) {
+    auto planted = Generators::plantedColoring({.nodesCount = 20000, .chromaticNumber = 4, .interPartProbability = 0.001, .seed = 9});
+
+    DegreeMetrics single(planted.graph, 1);
+    DegreeMetrics parallel(planted.graph, 4);
+
+    ASSERT_EQ(single.indices().firstZagreb, parallel.indices().firstZagreb);
+    ASSERT_EQ(single.indices().secondZagreb, parallel.indices().secondZagreb);
+    ASSERT_NEAR(single.indices().randic, parallel.indices().randic, 1e-6 * single.indices().randic);
+    ASSERT_NEAR(single.indices().atomBondConnectivity, parallel.indices().atomBondConnectivity, 1e-6 * single.indices().atomBondConnectivity);
+    ASSERT_NEAR(single.indices().estrada, parallel.indices().estrada, 1e-6 * single.indices().estrada);
+}
+} // namespace Graphs::Metrics
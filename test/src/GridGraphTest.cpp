@@ -0,0 +1,50 @@
+#include <Graphs/GridGraph.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string gridFile = "../test/sample/pixelMap.txt";
+
+namespace Graphs
+{
+TEST(GridGraphTest, pixelIndexingFourConnected) {
+    Data::Pixel_map map(gridFile);
+    GridGraph graph(map);
+
+    ASSERT_EQ(28, graph.nodesAmount());
+    ASSERT_EQ(std::vector<NodeId>({2, 11}), graph.getNeighborsOf(1));
+    ASSERT_EQ(0, graph.nodeDegree(0));
+    ASSERT_TRUE(graph.findEdge({1, 11}).weight.has_value());
+    ASSERT_FALSE(graph.findEdge({1, 12}).weight.has_value());
+}
+
+TEST(GridGraphTest, eightConnectedDoesNotCutCorners) {
+    Data::Pixel_map map(gridFile);
+    GridGraph graph(map, GridGraph::Connectivity::eight);
+
+    // (1, 0) -> (2, 1) is diagonal with both (1, 1) and (2, 0) open
+    ASSERT_TRUE(graph.findEdge({10, 21}).weight.has_value());
+    // (1, 5) -> (2, 6) is diagonal with (1, 6) being a wall
+    ASSERT_FALSE(graph.findEdge({15, 26}).weight.has_value());
+}
+
+TEST(GridGraphTest, compactIndexingMatchesPixelIndexing) {
+    Data::Pixel_map map(gridFile, Data::Pixel_map::Storage::bits);
+    GridGraph pixelGraph(map, GridGraph::Connectivity::eight);
+    GridGraph compactGraph(map, GridGraph::Connectivity::eight, GridGraph::Indexing::compact);
+
+    auto pixelIds = pixelGraph.getNodeIds();
+    auto compactIds = compactGraph.getNodeIds();
+    ASSERT_EQ(pixelIds.size(), compactIds.size());
+
+    for (NodeId i = 0; i < compactIds.size(); i++)
+    {
+        ASSERT_EQ(i, compactIds[i]);
+        auto [row, column] = compactGraph.toCoord(i);
+        ASSERT_EQ(pixelIds[i], row * map.get_columns() + column);
+        ASSERT_EQ(i, compactGraph.toNodeId(row, column));
+        ASSERT_EQ(pixelGraph.nodeDegree(pixelIds[i]), compactGraph.nodeDegree(i));
+    }
+}
+} // namespace Graphs
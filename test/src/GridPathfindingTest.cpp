@@ -0,0 +1,130 @@
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <Graphs/GridPathfinding.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+using namespace testing;
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+std::string writeRandomMap(uint32_t rows, uint32_t columns, double wallProbability, uint32_t seed) {
+    auto path = (std::filesystem::temp_directory_path() / "GridPathfindingTest.txt").string();
+    std::ofstream file(path);
+    std::mt19937 engine(seed);
+    std::bernoulli_distribution wall(wallProbability);
+
+    for (uint32_t i = 0; i < rows; i++)
+    {
+        for (uint32_t j = 0; j < columns; j++)
+        {
+            file << (i + j == 0 or i + j == rows + columns - 2 ? 0 : wall(engine)) << ' ';
+        }
+        file << '\n';
+    }
+    return path;
+}
+
+void expectValidPath(const Data::Pixel_map& map, const GridPath& path, bool diagonal) {
+    for (std::size_t i = 0; i + 1 < path.pixels.size(); i++)
+    {
+        auto [row, column] = path.pixels[i];
+        auto [nextRow, nextColumn] = path.pixels[i + 1];
+        auto rowDistance = std::abs(static_cast<int64_t>(row) - nextRow);
+        auto columnDistance = std::abs(static_cast<int64_t>(column) - nextColumn);
+
+        ASSERT_EQ(0, map.get_field(nextRow, nextColumn));
+        ASSERT_LE(rowDistance, 1);
+        ASSERT_LE(columnDistance, 1);
+        ASSERT_TRUE(diagonal or rowDistance + columnDistance == 1);
+        if (rowDistance + columnDistance == 2)
+        {
+            ASSERT_EQ(0, map.get_field(row, nextColumn));
+            ASSERT_EQ(0, map.get_field(nextRow, column));
+        }
+    }
+}
+} // namespace
+
+TEST(GridPathfindingTest, fourConnectedSearchesAgree) {
+    auto path = writeRandomMap(40, 60, 0.3, 11);
+    Data::Pixel_map map(path);
+    std::filesystem::remove(path);
+
+    GridPathfinder pathfinder(map);
+    GridPath breadthFirstPath;
+    GridPath aStarPath;
+
+    std::mt19937 engine(5);
+    for (int query = 0; query < 200; query++)
+    {
+        Data::coord start{static_cast<uint32_t>(engine() % 40), static_cast<uint32_t>(engine() % 60)};
+        Data::coord goal{static_cast<uint32_t>(engine() % 40), static_cast<uint32_t>(engine() % 60)};
+
+        bool foundBreadthFirst = pathfinder.breadthFirst(start, goal, breadthFirstPath);
+        bool foundAStar = pathfinder.aStar(start, goal, aStarPath);
+
+        ASSERT_EQ(foundBreadthFirst, foundAStar);
+        if (foundAStar)
+        {
+            ASSERT_DOUBLE_EQ(breadthFirstPath.length, aStarPath.length);
+            expectValidPath(map, breadthFirstPath, false);
+            expectValidPath(map, aStarPath, false);
+            ASSERT_EQ(goal.x, aStarPath.pixels.back().x);
+            ASSERT_EQ(goal.y, breadthFirstPath.pixels.back().y);
+        }
+    }
+}
+
+TEST(GridPathfindingTest, jumpPointSearchMatchesAStar) {
+    auto path = writeRandomMap(50, 50, 0.25, 3);
+    Data::Pixel_map map(path, Data::Pixel_map::Storage::bits);
+    std::filesystem::remove(path);
+
+    GridPathfinder pathfinder(map, GridGraph::Connectivity::eight);
+    GridPath aStarPath;
+    GridPath jumpPointPath;
+
+    std::mt19937 engine(8);
+    for (int query = 0; query < 200; query++)
+    {
+        Data::coord start{static_cast<uint32_t>(engine() % 50), static_cast<uint32_t>(engine() % 50)};
+        Data::coord goal{static_cast<uint32_t>(engine() % 50), static_cast<uint32_t>(engine() % 50)};
+
+        bool foundAStar = pathfinder.aStar(start, goal, aStarPath);
+        bool foundJumpPoint = pathfinder.jumpPoint(start, goal, jumpPointPath);
+
+        ASSERT_EQ(foundAStar, foundJumpPoint);
+        if (foundAStar)
+        {
+            ASSERT_NEAR(aStarPath.length, jumpPointPath.length, 1e-9);
+            ASSERT_LE(jumpPointPath.expandedNodes, aStarPath.expandedNodes);
+            expectValidPath(map, jumpPointPath, true);
+            ASSERT_EQ(start.x, jumpPointPath.pixels.front().x);
+            ASSERT_EQ(goal.y, jumpPointPath.pixels.back().y);
+        }
+    }
+}
+
+TEST(GridPathfindingTest, cornerToCornerOnOpenMap) {
+    auto path = writeRandomMap(10, 10, 0.0, 1);
+    Data::Pixel_map map(path);
+    std::filesystem::remove(path);
+
+    GridPathfinder pathfinder(map, GridGraph::Connectivity::eight);
+    GridPath result;
+
+    ASSERT_TRUE(pathfinder.jumpPoint({0, 0}, {9, 9}, result));
+    ASSERT_EQ(10, result.pixels.size());
+    ASSERT_NEAR(9 * std::sqrt(2.0), result.length, 1e-9);
+
+    ASSERT_TRUE(pathfinder.breadthFirst({0, 0}, {9, 9}, result));
+    ASSERT_EQ(10, result.pixels.size());
+
+    ASSERT_THROW(pathfinder.aStar({0, 0}, {10, 0}, result), std::out_of_range);
+}
+} // namespace Graphs::Algorithm
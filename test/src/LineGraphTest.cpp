@@ -0,0 +1,83 @@
+#include <Graphs/AdjList.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/LineGraph.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string lineGraphListFile = "../test/sample/adjList.lst";
+
+namespace Graphs
+{
+TEST(LineGraphTest, triangleIsItsOwnLineGraph) {
+    std::vector<EdgeInfo> edges = {
+        {0, 1},
+        {1, 0},
+        {1, 2},
+        {2, 0}
+    };
+    auto line = makeLineGraph(CsrGraph(3, edges));
+
+    ASSERT_EQ(3, line.edges.edgesAmount());
+    ASSERT_EQ(3, line.graph.nodesAmount());
+    ASSERT_EQ(6, line.graph.edgesAmount());
+    ASSERT_EQ(EdgeIndex::Endpoints(0, 1), line.edges.endpoints(0));
+    ASSERT_EQ(EdgeIndex::Endpoints(0, 2), line.edges.endpoints(1));
+    ASSERT_EQ(EdgeIndex::Endpoints(1, 2), line.edges.endpoints(2));
+}
+
+TEST(LineGraphTest, starBecomesClique) {
+    std::vector<EdgeInfo> edges = {
+        {0, 1},
+        {0, 2},
+        {0, 3},
+        {0, 0}
+    };
+    auto line = makeLineGraph(CsrGraph(4, edges));
+
+    ASSERT_EQ(3, line.graph.nodesAmount());
+    ASSERT_EQ(3, line.edges.maxDegree());
+    for (NodeId node = 0; node < 3; node++)
+    {
+        ASSERT_EQ(2, line.graph.nodeDegree(node));
+    }
+}
+
+TEST(LineGraphTest, pathShrinksByOneNode) {
+    std::vector<EdgeInfo> edges = {
+        {0, 1},
+        {1, 2},
+        {2, 3}
+    };
+    auto line = makeLineGraph(CsrGraph(4, edges));
+
+    ASSERT_EQ(3, line.graph.nodesAmount());
+    ASSERT_EQ(std::vector<NodeId>({1}), line.graph.getNeighborsOf(0));
+    ASSERT_EQ(std::vector<NodeId>({0, 2}), line.graph.getNeighborsOf(1));
+    ASSERT_EQ(std::vector<NodeId>({1}), line.graph.getNeighborsOf(2));
+}
+
+TEST(LineGraphTest, arcsMatchDegreeSum) {
+    AdjList list(lineGraphListFile);
+    auto line = makeLineGraph(list);
+
+    uint64_t expectedArcs = 0;
+    for (NodeId node = 0; node < line.edges.nodesAmount(); node++)
+    {
+        uint64_t degree = line.edges.incidentEdges(node).size();
+        expectedArcs += degree * (degree - 1);
+    }
+    ASSERT_EQ(expectedArcs, line.graph.edgesAmount());
+
+    for (EdgeId edge = 0; edge < line.edges.edgesAmount(); edge++)
+    {
+        auto [lower, higher] = line.edges.endpoints(edge);
+        for (auto neighbor : line.graph.neighbors(edge))
+        {
+            auto [otherLower, otherHigher] = line.edges.endpoints(neighbor);
+            ASSERT_TRUE(lower == otherLower or lower == otherHigher or higher == otherLower or higher == otherHigher);
+        }
+    }
+}
+} // namespace Graphs
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/MaxFlow.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+
+using namespace testing;
+
+const std::string capacitiesFile = "../BenchmarkSamples/SSP_test/graph_10.mat";
+const std::string throughputsFile = "../BenchmarkSamples/SSP_test/graph_50_thr.mat";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+/* A valid flow whose value equals the capacity of the reported cut is maximum */
+void expectMaximumFlow(const FlowResult& result, NodeId source, NodeId sink) {
+    std::map<NodeId, int64_t> balance;
+    for (const auto& edge : result.edgeFlows)
+    {
+        ASSERT_LE(edge.flow, edge.capacity);
+        balance[edge.source] -= edge.flow;
+        balance[edge.destination] += edge.flow;
+    }
+    for (const auto& [node, value] : balance)
+    {
+        if (node != source and node != sink)
+        {
+            ASSERT_EQ(0, value) << "node " << node;
+        }
+    }
+    ASSERT_EQ(static_cast<int64_t>(result.value), balance[sink]);
+
+    uint64_t cutCapacity = 0;
+    for (const auto& edge : result.cutEdges)
+    {
+        ASSERT_EQ(edge.capacity, edge.flow);
+        cutCapacity += edge.capacity;
+    }
+    ASSERT_EQ(result.value, cutCapacity);
+    ASSERT_TRUE(std::binary_search(result.sourceSide.begin(), result.sourceSide.end(), source));
+    ASSERT_FALSE(std::binary_search(result.sourceSide.begin(), result.sourceSide.end(), sink));
+}
+
+CsrGraph randomNetwork(uint32_t nodesCount, double probability, uint64_t seed) {
+    std::mt19937_64 engine(seed);
+    std::bernoulli_distribution coin(probability);
+    std::uniform_int_distribution<uint32_t> capacity(1, 20);
+    std::vector<EdgeInfo> edges;
+    for (NodeId u = 0; u < nodesCount; u++)
+    {
+        for (NodeId v = 0; v < nodesCount; v++)
+        {
+            if (u != v and coin(engine))
+            {
+                edges.push_back({u, v, capacity(engine)});
+            }
+        }
+    }
+    return CsrGraph(nodesCount, edges);
+}
+} // namespace
+
+class MaxFlowTest : public TestWithParam<MaxFlow::Method>
+{};
+
+TEST_P(MaxFlowTest, findsFlowOfTextbookNetwork) {
+    std::vector<EdgeInfo> edges = {{0, 1, 16}, {0, 2, 13}, {1, 3, 12}, {2, 1, 4}, {2, 4, 14},
+                                   {3, 2, 9},  {3, 5, 20}, {4, 3, 7},  {4, 5, 4}};
+    CsrGraph graph(6, edges);
+    auto result = std::make_shared<FlowResult>();
+
+    MaxFlow{result, 0, 5, GetParam()}(graph);
+
+    ASSERT_EQ(23u, result->value);
+    ASSERT_EQ(edges.size(), result->edgeFlows.size());
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 2, 4}), result->sourceSide);
+    expectMaximumFlow(*result, 0, 5);
+}
+
+TEST_P(MaxFlowTest, usesUnitCapacitiesOfUnweightedGraph) {
+    std::vector<EdgeInfo> edges = {{0, 1}, {0, 2}, {0, 3}, {1, 4}, {2, 4}, {3, 1}, {4, 0}};
+    CsrGraph graph(5, edges);
+    auto result = std::make_shared<FlowResult>();
+
+    MaxFlow{result, 0, 4, GetParam()}(graph);
+
+    ASSERT_EQ(2u, result->value);
+    expectMaximumFlow(*result, 0, 4);
+}
+
+TEST_P(MaxFlowTest, findsNoFlowToUnreachableSink) {
+    CsrGraph graph(4, std::vector<EdgeInfo>{{0, 1, 5}, {2, 3, 5}, {3, 0, 5}});
+    auto result = std::make_shared<FlowResult>();
+
+    MaxFlow{result, 0, 3, GetParam()}(graph);
+
+    ASSERT_EQ(0u, result->value);
+    ASSERT_EQ(std::vector<NodeId>({0, 1}), result->sourceSide);
+    ASSERT_TRUE(result->cutEdges.empty());
+}
+
+TEST_P(MaxFlowTest, findsMaximumFlowOfSampleMatrices) {
+    for (const auto& file : {capacitiesFile, throughputsFile})
+    {
+        AdjMatrix graph(file);
+        auto nodeIds = graph.getNodeIds();
+        auto result = std::make_shared<FlowResult>();
+
+        MaxFlow{result, nodeIds.front(), nodeIds.back(), GetParam()}(graph);
+
+        ASSERT_GT(result->value, 0u);
+        expectMaximumFlow(*result, nodeIds.front(), nodeIds.back());
+    }
+}
+
+TEST_P(MaxFlowTest, agreesWithOtherMethodOnRandomNetworks) {
+    auto other = GetParam() == MaxFlow::Method::dinic ? MaxFlow::Method::pushRelabel : MaxFlow::Method::dinic;
+    for (uint64_t seed = 0; seed < 50; seed++)
+    {
+        auto graph = randomNetwork(40, 0.08, seed);
+        auto result = std::make_shared<FlowResult>();
+        auto reference = std::make_shared<FlowResult>();
+
+        MaxFlow{result, 0, 39, GetParam()}(graph);
+        MaxFlow{reference, 0, 39, other}(graph);
+
+        ASSERT_EQ(reference->value, result->value) << "seed " << seed;
+        expectMaximumFlow(*result, 0, 39);
+    }
+}
+
+TEST_P(MaxFlowTest, throwsOnInvalidTerminals) {
+    CsrGraph graph(2, std::vector<EdgeInfo>{{0, 1, 1}});
+
+    ASSERT_THROW(MaxFlow(nullptr, 0, 1), std::invalid_argument);
+    ASSERT_THROW(MaxFlow(std::make_shared<FlowResult>(), 1, 1), std::invalid_argument);
+    ASSERT_THROW(MaxFlow(std::make_shared<FlowResult>(), 0, 7, GetParam())(graph), std::out_of_range);
+}
+
+INSTANTIATE_TEST_SUITE_P(Methods, MaxFlowTest, Values(MaxFlow::Method::pushRelabel, MaxFlow::Method::dinic));
+} // namespace Graphs::Algorithm
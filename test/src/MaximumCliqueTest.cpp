@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <Graphs/AdjList.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <Graphs/MaximumClique.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+using namespace testing;
+
+const std::string cliqueListFile = "../BenchmarkSamples/chrom_num_7/1.lst";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+bool isClique(const Graph& graph, const std::vector<NodeId>& nodes) {
+    for (auto lhs : nodes)
+    {
+        for (auto rhs : nodes)
+        {
+            if (lhs != rhs and not graph.findEdge({lhs, rhs}).weight.has_value())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* Random graph with a clique planted on every third of the first cliqueSize * 3 nodes */
+CsrGraph plantedClique(uint32_t nodesCount, double probability, uint32_t cliqueSize, uint64_t seed) {
+    std::mt19937_64 engine(seed);
+    std::bernoulli_distribution coin(probability);
+    std::vector<EdgeInfo> edges;
+    for (NodeId u = 0; u < nodesCount; u++)
+    {
+        for (NodeId v = u + 1; v < nodesCount; v++)
+        {
+            bool planted = u % 3 == 0 and v % 3 == 0 and v < cliqueSize * 3;
+            if (planted or coin(engine))
+            {
+                edges.push_back({u, v});
+                edges.push_back({v, u});
+            }
+        }
+    }
+    return CsrGraph(nodesCount, edges);
+}
+} // namespace
+
+TEST(MaximumCliqueTest, findsCliqueOfSampleGraph) {
+    AdjList graph(cliqueListFile);
+    auto result = std::make_shared<CliqueResult>();
+
+    MaximumClique{result}(graph);
+
+    ASSERT_TRUE(result->optimal);
+    ASSERT_EQ(std::vector<NodeId>({4, 5, 6, 7, 8, 9, 10}), result->clique);
+}
+
+TEST(MaximumCliqueTest, threadsAgreeOnPlantedClique) {
+    auto graph = plantedClique(300, 0.3, 12, 4);
+    auto sequential = std::make_shared<CliqueResult>();
+    auto parallel = std::make_shared<CliqueResult>();
+
+    MaximumClique{sequential}(graph);
+    MaximumClique{parallel, 4}(graph);
+
+    ASSERT_TRUE(sequential->optimal);
+    ASSERT_TRUE(parallel->optimal);
+    ASSERT_EQ(12, sequential->clique.size());
+    ASSERT_EQ(12, parallel->clique.size());
+    ASSERT_TRUE(isClique(graph, parallel->clique));
+}
+
+TEST(MaximumCliqueTest, reportsProgressAndStopsAtTimeLimit) {
+    auto graph = plantedClique(400, 0.9, 4, 2);
+    auto result = std::make_shared<CliqueResult>();
+    std::vector<uint32_t> sizes;
+
+    MaximumClique{result, 2, std::chrono::milliseconds(50), [&sizes](const CliqueProgress& progress) {
+                      sizes.push_back(progress.incumbentSize);
+                  }}(graph);
+
+    ASSERT_FALSE(result->optimal);
+    ASSERT_TRUE(isClique(graph, result->clique));
+    ASSERT_TRUE(std::ranges::is_sorted(sizes));
+    if (not sizes.empty())
+    {
+        ASSERT_EQ(sizes.back(), result->clique.size());
+    }
+}
+} // namespace Graphs::Algorithm
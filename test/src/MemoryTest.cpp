@@ -0,0 +1,206 @@
+#include <filesystem>
+#include <Graphs/AdjList.hpp>
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/BreadthFirstSearch.hpp>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/DynamicGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <Graphs/Memory.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+const std::string memoryListFile = "../test/sample/adjList.lst";
+const std::string memoryMatrixFile = "../test/sample/adjMat.mat";
+
+namespace Graphs::Memory
+{
+TEST(MemoryTest, countingResourceTracksLiveAndPeakBytes) {
+    CountingResource counter;
+    {
+        std::pmr::vector<uint64_t> first(100, 0, &counter);
+        std::pmr::vector<uint64_t> second(50, 0, &counter);
+        second.clear();
+        second.shrink_to_fit();
+    }
+
+    auto stats = counter.stats();
+    ASSERT_EQ(2, stats.allocations);
+    ASSERT_EQ(2, stats.deallocations);
+    ASSERT_EQ(150 * sizeof(uint64_t), stats.allocatedBytes);
+    ASSERT_EQ(150 * sizeof(uint64_t), stats.peakBytes);
+
+    counter.reset();
+    ASSERT_EQ(0, counter.stats().allocations);
+    ASSERT_EQ(0, counter.stats().peakBytes);
+}
+
+TEST(MemoryTest, scopedDefaultResourceIsRestored) {
+    auto* previous = std::pmr::get_default_resource();
+    CountingResource counter;
+    {
+        ScopedDefaultResource scope(&counter);
+        ASSERT_EQ(&counter, std::pmr::get_default_resource());
+        std::pmr::vector<uint32_t> values(10);
+    }
+    ASSERT_EQ(previous, std::pmr::get_default_resource());
+    ASSERT_EQ(1, counter.stats().allocations);
+}
+
+TEST(MemoryTest, adjListStoresNeighborsInGivenResource) {
+    CountingResource counter;
+    {
+        AdjList adjList(memoryListFile, &counter);
+        auto loaded = counter.stats().allocations;
+        ASSERT_GT(loaded, 0);
+
+        adjList.setEdges(std::vector<EdgeInfo>{{1, 9}, {3, 1}, {2, 8}});
+        adjList.removeNode(4);
+        adjList.removeEdges(std::vector<EdgeInfo>{{1, 9}});
+        adjList.compact();
+
+        ASSERT_EQ(std::vector<NodeId>({2, 6}), adjList.getNeighborsOf(1));
+        ASSERT_EQ(std::vector<NodeId>({1, 7}), adjList.getNeighborsOf(3));
+        ASSERT_TRUE(adjList.getNeighborsOf(4).empty());
+        ASSERT_GT(counter.stats().allocations, loaded);
+    }
+    auto stats = counter.stats();
+    ASSERT_EQ(stats.allocations, stats.deallocations);
+}
+
+TEST(MemoryTest, adjMatrixStoresRowsInGivenResource) {
+    CountingResource counter;
+    {
+        AdjMatrix adjMatrix(memoryMatrixFile, &counter);
+        auto loaded = counter.stats().allocations;
+        ASSERT_GT(loaded, 0);
+
+        adjMatrix.addNodes(2);
+        adjMatrix.removeNode(1);
+        adjMatrix.compact();
+        ASSERT_GT(counter.stats().allocations, loaded);
+
+        AdjMatrix copy(adjMatrix, &counter);
+        ASSERT_EQ(adjMatrix.nodesAmount(), copy.nodesAmount());
+    }
+    auto stats = counter.stats();
+    ASSERT_EQ(stats.allocations, stats.deallocations);
+}
+
+TEST(MemoryTest, dynamicGraphStoresTablesInGivenResource) {
+    CountingResource counter;
+    {
+        DynamicGraph graph(64, &counter);
+        for (NodeId node = 0; node + 1 < 64; node++)
+        {
+            graph.setEdge({node, node + 1, node});
+        }
+        graph.addNodes(8);
+        graph.removeNode(10);
+
+        auto moved = std::move(graph);
+        ASSERT_EQ(61, moved.edgesAmount());
+        ASSERT_EQ(std::vector<NodeId>({12}), moved.getNeighborsOf(11));
+        ASSERT_EQ(11u, moved.findEdge({11, 12}).weight.value());
+        ASSERT_GT(counter.stats().allocations, 64);
+    }
+    auto stats = counter.stats();
+    ASSERT_EQ(stats.allocations, stats.deallocations);
+}
+
+TEST(MemoryTest, greedyColoringScratchNeedsFewAllocations) {
+    auto graph = Generators::rmat({.scale = 12, .edgeFactor = 8, .seed = 5});
+    auto result = std::make_shared<Algorithm::ColoringResult>();
+
+    CountingResource counter(std::pmr::get_default_resource());
+    {
+        ScopedDefaultResource scope(&counter);
+        Algorithm::GreedyColoring<Algorithm::notVerbose>{result}(graph);
+    }
+
+    // thousands of hash nodes would otherwise mean thousands of allocations
+    auto stats = counter.stats();
+    ASSERT_EQ(graph.nodesAmount(), result->size());
+    ASSERT_LE(stats.allocations, 8);
+    ASSERT_EQ(stats.allocations, stats.deallocations);
+}
+
+class PlacementTest : public TestWithParam<Placement>
+{
+};
+
+TEST_P(PlacementTest, largeBuffersAreUsableAndReleased) {
+    CountingResource upstream;
+    PlacementResource resource(GetParam(), &upstream);
+    {
+        std::pmr::vector<uint64_t> large(3 * PlacementResource::hugePageSize / sizeof(uint64_t) + 5, 0, &resource);
+        std::iota(large.begin(), large.end(), 0);
+        ASSERT_EQ(large.size() - 1, large.back());
+
+        std::pmr::vector<uint32_t> small(16, 7, &resource);
+        ASSERT_EQ(7, small.front());
+    }
+
+    // only small blocks, or everything under the plain placement, reach the upstream
+    auto stats = upstream.stats();
+    auto plain = GetParam().pages == PageSize::standard and GetParam().numa == NumaPolicy::none;
+    ASSERT_EQ(plain ? 2 : 1, stats.allocations);
+    ASSERT_EQ(stats.allocations, stats.deallocations);
+
+    auto achieved = resource.effective();
+    if (GetParam().pages == PageSize::standard)
+    {
+        ASSERT_EQ(PageSize::standard, achieved.pages);
+    }
+    if (onlineNumaNodes().size() < 2)
+    {
+        ASSERT_EQ(NumaPolicy::none, achieved.numa);
+    }
+}
+
+TEST_P(PlacementTest, placedCsrGraphMatchesDefaultOne) {
+    // a circulant graph, big enough for its adjacency array to be mapped by the resource
+    constexpr uint32_t nodesCount = 1 << 16;
+    std::vector<EdgeInfo> edges;
+    for (NodeId node = 0; node < nodesCount; node++)
+    {
+        for (NodeId step : {1u, 2u, 3u, 5u, 8u, 13u, 21u, 34u})
+        {
+            edges.push_back({node, (node + step) % nodesCount});
+        }
+    }
+    CsrGraph graph(nodesCount, edges);
+    ASSERT_GE(graph.edgesAmount() * sizeof(NodeId), PlacementResource::hugePageSize);
+
+    auto path = (std::filesystem::temp_directory_path() / "MemoryTest.csr").string();
+    graph.save(path);
+
+    PlacementResource resource(GetParam());
+    CsrGraph placed(path, &resource);
+    std::filesystem::remove(path);
+    ASSERT_EQ(graph.edgesAmount(), placed.edgesAmount());
+    for (NodeId node = 0; node < graph.nodesAmount(); node += 97)
+    {
+        ASSERT_TRUE(std::ranges::equal(graph.neighbors(node), placed.neighbors(node)));
+    }
+
+    auto expected = std::make_shared<Algorithm::BfsResult>();
+    auto actual = std::make_shared<Algorithm::BfsResult>();
+    Algorithm::BreadthFirstSearch{expected, 0, Algorithm::BreadthFirstSearch::Method::queue}(graph);
+    Algorithm::BreadthFirstSearch{actual, 0, Algorithm::BreadthFirstSearch::Method::directionOptimizing, 2}(placed);
+    ASSERT_EQ(expected->levels, actual->levels);
+}
+
+INSTANTIATE_TEST_SUITE_P(Placements,
+                         PlacementTest,
+                         Values(Placement{PageSize::standard, NumaPolicy::none},
+                                Placement{PageSize::transparentHuge, NumaPolicy::none},
+                                Placement{PageSize::hugeTlb, NumaPolicy::none},
+                                Placement{PageSize::standard, NumaPolicy::interleave},
+                                Placement{PageSize::transparentHuge, NumaPolicy::firstTouch, 2}));
+} // namespace Graphs::Memory
@@ -0,0 +1,154 @@
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/ConnectedComponents.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/DisjointSets.hpp>
+#include <Graphs/MinimumSpanningForest.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+using namespace testing;
+
+const std::string weightedMatrixFile = "../BenchmarkSamples/SSP_test/graph_100.mat";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+std::vector<EdgeInfo> randomEdges(uint32_t nodesCount, uint32_t edgesCount, uint32_t maxWeight, uint64_t seed) {
+    std::mt19937_64 engine(seed);
+    std::uniform_int_distribution<NodeId> node(0, nodesCount - 1);
+    std::uniform_int_distribution<uint32_t> weight(1, maxWeight);
+    std::vector<EdgeInfo> edges;
+    for (uint32_t i = 0; i < edgesCount; i++)
+    {
+        edges.push_back({node(engine), node(engine), weight(engine)});
+    }
+    return edges;
+}
+
+/* Acyclic and with as many trees as the graph has components */
+void expectSpanningForest(const Graph& graph, const SpanningForest& forest) {
+    auto components = std::make_shared<ComponentLabels>();
+    ConnectedComponents{components}(graph);
+    ASSERT_EQ(components->componentsAmount(), forest.treesAmount);
+    ASSERT_EQ(graph.nodesAmount() - forest.treesAmount, forest.edges.size());
+
+    DisjointSets sets(components->labels.size());
+    uint64_t totalWeight = 0;
+    for (const auto& edge : forest.edges)
+    {
+        ASSERT_TRUE(sets.unite(edge.source, edge.destination));
+        totalWeight += edge.weight.value();
+    }
+    ASSERT_EQ(totalWeight, forest.totalWeight);
+}
+} // namespace
+
+class MinimumSpanningForestTest : public TestWithParam<MinimumSpanningForest::Method>
+{};
+
+TEST_P(MinimumSpanningForestTest, findsTreeOfSmallGraph) {
+    CsrGraph graph(5, std::vector<EdgeInfo>{{0, 1, 4}, {0, 2, 1}, {2, 1, 2}, {1, 3, 5}, {2, 3, 8}, {3, 4, 3}, {4, 0, 9}});
+    auto result = std::make_shared<SpanningForest>();
+
+    MinimumSpanningForest{result, GetParam(), 2}(graph);
+
+    ASSERT_EQ(11u, result->totalWeight);
+    ASSERT_EQ(1u, result->treesAmount);
+    std::vector<EdgeInfo> expected = {{0, 2, 1}, {1, 3, 5}, {2, 1, 2}, {3, 4, 3}};
+    ASSERT_EQ(expected.size(), result->edges.size());
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_EQ(expected[i].source, result->edges[i].source);
+        ASSERT_EQ(expected[i].destination, result->edges[i].destination);
+        ASSERT_EQ(expected[i].weight, result->edges[i].weight);
+    }
+}
+
+TEST_P(MinimumSpanningForestTest, spansEveryComponentOfForest) {
+    CsrGraph graph(7, std::vector<EdgeInfo>{{0, 1}, {1, 2}, {2, 0}, {3, 4}, {5, 5}});
+    auto result = std::make_shared<SpanningForest>();
+
+    MinimumSpanningForest{result, GetParam()}(graph);
+
+    ASSERT_EQ(3u, result->totalWeight);
+    expectSpanningForest(graph, *result);
+}
+
+TEST_P(MinimumSpanningForestTest, findsTreeOfSampleMatrix) {
+    AdjMatrix graph(weightedMatrixFile);
+    auto result = std::make_shared<SpanningForest>();
+    auto reference = std::make_shared<SpanningForest>();
+
+    MinimumSpanningForest{result, GetParam()}(graph);
+    MinimumSpanningForest{reference, MinimumSpanningForest::Method::kruskal, 1}(graph);
+
+    ASSERT_EQ(1u, result->treesAmount);
+    ASSERT_EQ(reference->totalWeight, result->totalWeight);
+    expectSpanningForest(graph, *result);
+}
+
+TEST_P(MinimumSpanningForestTest, matchesKruskalOnLargeRandomGraphs) {
+    for (uint64_t seed = 0; seed < 3; seed++)
+    {
+        CsrGraph graph(20000, randomEdges(20000, 60000, 100, seed));
+        auto result = std::make_shared<SpanningForest>();
+        auto reference = std::make_shared<SpanningForest>();
+
+        MinimumSpanningForest{result, GetParam(), 4}(graph);
+        MinimumSpanningForest{reference, MinimumSpanningForest::Method::kruskal, 1}(graph);
+
+        ASSERT_EQ(reference->totalWeight, result->totalWeight);
+        ASSERT_EQ(reference->edges.size(), result->edges.size());
+        for (std::size_t i = 0; i < result->edges.size(); i++)
+        {
+            ASSERT_EQ(reference->edges[i].source, result->edges[i].source);
+            ASSERT_EQ(reference->edges[i].destination, result->edges[i].destination);
+        }
+        expectSpanningForest(graph, *result);
+    }
+}
+
+TEST_P(MinimumSpanningForestTest, throwsOnNullResult) {
+    ASSERT_THROW(MinimumSpanningForest(nullptr, GetParam()), std::invalid_argument);
+}
+
+INSTANTIATE_TEST_SUITE_P(Methods,
+                         MinimumSpanningForestTest,
+                         Values(MinimumSpanningForest::Method::kruskal,
+                                MinimumSpanningForest::Method::prim,
+                                MinimumSpanningForest::Method::boruvka));
+
+TEST(StreamingSpanningForestTest, matchesForestOfWholeGraph) {
+    auto edges = randomEdges(3000, 20000, 50, 7);
+    CsrGraph graph(3000, edges);
+    auto reference = std::make_shared<SpanningForest>();
+    MinimumSpanningForest{reference}(graph);
+
+    StreamingSpanningForest stream(1000);
+    for (const auto& edge : edges)
+    {
+        stream.insert(edge);
+    }
+    auto forest = stream.forest();
+
+    ASSERT_EQ(reference->totalWeight, forest.totalWeight);
+    ASSERT_EQ(reference->treesAmount, forest.treesAmount);
+    expectSpanningForest(graph, forest);
+}
+
+TEST(StreamingSpanningForestTest, replacesHeavierEdgesOfEarlierBatches) {
+    StreamingSpanningForest stream(2);
+    stream.insert({0, 1, 10});
+    stream.insert({1, 2, 10});
+    stream.insert({0, 2, 1});
+    stream.insert({3, 3, 1});
+
+    auto forest = stream.forest();
+
+    ASSERT_EQ(11u, forest.totalWeight);
+    ASSERT_EQ(2u, forest.edges.size());
+    ASSERT_EQ(2u, forest.treesAmount);
+}
+} // namespace Graphs::Algorithm
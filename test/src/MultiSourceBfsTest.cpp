@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <Graphs/AdjList.hpp>
+#include <Graphs/BreadthFirstSearch.hpp>
+#include <Graphs/Generators.hpp>
+#include <Graphs/MultiSourceBfs.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string msBfsListFile = "../test/sample/adjList.lst";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+using Distances = std::vector<std::vector<uint32_t>>;
+
+Distances multiSourceDistances(const Graph& graph, const std::vector<NodeId>& sources, MultiSourceBfs::Width width) {
+    auto nodeIds = graph.getNodeIds();
+    const auto size = static_cast<std::size_t>(*std::ranges::max_element(nodeIds)) + 1;
+    Distances distances(sources.size(), std::vector<uint32_t>(size, BfsResult::unreached));
+
+    MultiSourceBfs{sources,
+                   [&distances](uint32_t source, NodeId node, uint32_t distance) {
+                       EXPECT_EQ(BfsResult::unreached, distances[source][node]);
+                       distances[source][node] = distance;
+                   },
+                   width}(graph);
+    return distances;
+}
+
+void expectMatchesSingleSource(const Graph& graph, const std::vector<NodeId>& sources) {
+    auto result = std::make_shared<BfsResult>();
+    for (auto width : {MultiSourceBfs::Width::bits64, MultiSourceBfs::Width::bits256})
+    {
+        auto distances = multiSourceDistances(graph, sources, width);
+        for (std::size_t i = 0; i < sources.size(); i++)
+        {
+            BreadthFirstSearch{result, sources[i]}(graph);
+            ASSERT_EQ(result->levels, distances[i]);
+        }
+    }
+}
+} // namespace
+
+TEST(MultiSourceBfsTest, matchesSingleSourceOnGeneratedGraph) {
+    auto graph = Generators::rmat({.scale = 10, .edgeFactor = 4, .seed = 9});
+    std::vector<NodeId> sources;
+    for (NodeId source = 0; source < 300; source++)
+    {
+        sources.push_back((source * 37) % graph.nodesAmount());
+    }
+    sources.push_back(sources.front());
+
+    expectMatchesSingleSource(graph, sources);
+}
+
+TEST(MultiSourceBfsTest, followsOutgoingEdgesOfAdjList) {
+    AdjList graph(msBfsListFile);
+    expectMatchesSingleSource(graph, graph.getNodeIds());
+
+    std::vector<EdgeInfo> edges = {{0, 1}, {1, 2}, {3, 0}};
+    CsrGraph directed(4, edges);
+    auto distances = multiSourceDistances(directed, {0, 3}, MultiSourceBfs::Width::bits64);
+    ASSERT_EQ(std::vector<uint32_t>({0, 1, 2, BfsResult::unreached}), distances[0]);
+    ASSERT_EQ(std::vector<uint32_t>({1, 2, 3, 0}), distances[1]);
+}
+
+TEST(MultiSourceBfsTest, rejectsUnknownSourcesAndEmptyVisitor) {
+    AdjList graph(msBfsListFile);
+    auto ignore = [](uint32_t, NodeId, uint32_t) {};
+
+    ASSERT_THROW(MultiSourceBfs({1, 0}, ignore)(graph), std::out_of_range);
+    ASSERT_THROW(MultiSourceBfs({1}, nullptr), std::invalid_argument);
+}
+} // namespace Graphs::Algorithm
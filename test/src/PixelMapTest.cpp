@@ -0,0 +1,90 @@
+#include <filesystem>
+#include <fstream>
+#include <Graphs/Pixel_map.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string pixelMapFile = "../test/sample/pixelMap.txt";
+
+namespace Data
+{
+class PixelMapTest : public TestWithParam<Pixel_map::Storage>
+{};
+
+TEST_P(PixelMapTest, createFromTextFile) {
+    Pixel_map map(pixelMapFile, GetParam());
+    ASSERT_EQ(5, map.get_rows());
+    ASSERT_EQ(10, map.get_columns());
+    ASSERT_EQ(1, map.get_field(0, 0));
+    ASSERT_EQ(0, map.get_field(0, 1));
+    ASSERT_EQ(1, map.get_field(1, 9));
+    ASSERT_EQ(0, map.get_field(4, 9));
+    ASSERT_EQ(1, map.get_field(4, 8));
+}
+
+TEST_P(PixelMapTest, binaryFileRoundTrip) {
+    auto path = (std::filesystem::temp_directory_path() / "PixelMapTest.pmb").string();
+
+    Pixel_map original(pixelMapFile, GetParam());
+    original.save_binary(path);
+    Pixel_map loaded(path, GetParam());
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(original.get_rows(), loaded.get_rows());
+    ASSERT_EQ(original.get_columns(), loaded.get_columns());
+    for (uint32_t i = 0; i < original.get_rows(); i++)
+    {
+        for (uint32_t j = 0; j < original.get_columns(); j++)
+        {
+            ASSERT_EQ(original.get_field(i, j), loaded.get_field(i, j));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Storages,
+                         PixelMapTest,
+                         Values(Pixel_map::Storage::bytes, Pixel_map::Storage::bits));
+
+TEST(PixelMapLoaderTest, toleratesCarriageReturnsAndBlankLines) {
+    auto path = (std::filesystem::temp_directory_path() / "PixelMapLoaderTest.txt").string();
+    {
+        std::ofstream file(path);
+        file << "0 1 1\r\n1 0 0\r\n\n0 0 1\n\n";
+    }
+
+    Pixel_map map(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(3, map.get_rows());
+    ASSERT_EQ(3, map.get_columns());
+    ASSERT_EQ(1, map.get_field(2, 2));
+}
+
+TEST(PixelMapLoaderTest, unevenRowsThrow) {
+    auto path = (std::filesystem::temp_directory_path() / "PixelMapLoaderTest.txt").string();
+    {
+        std::ofstream file(path);
+        file << "0 1 1\n1 0\n";
+    }
+
+    ASSERT_THROW(Pixel_map map(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(PixelMapLoaderTest, oversizedBinaryHeaderThrows) {
+    auto path = (std::filesystem::temp_directory_path() / "PixelMapLoaderTest.pmb").string();
+    Pixel_map(pixelMapFile).save_binary(path);
+    {
+        // rows follow the magic and the version
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        uint32_t rows = 1u << 30;
+        file.seekp(12);
+        file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    }
+
+    ASSERT_THROW(Pixel_map map(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+} // namespace Data
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <Graphs/AdjList.hpp>
+#include <Graphs/AdjMatrix.hpp>
+#include <Graphs/BreadthFirstSearch.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <Graphs/Reordering.hpp>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+#include <string>
+
+using namespace testing;
+
+const std::string reorderingLstFile = "../test/sample/adjList.lst";
+const std::string reorderingMatrixFile = "../BenchmarkSamples/SSP_test/graph_10.mat";
+
+namespace Graphs
+{
+namespace
+{
+/* Every edge of the graph has to appear between the new ids of its endpoints, with the same weight */
+void expectRelabeledCopy(const Graph& graph, const Relabeling& relabeling) {
+    ASSERT_EQ(graph.nodesAmount(), relabeling.graph.nodesAmount());
+    ASSERT_EQ(graph.nodesAmount(), relabeling.inverse.size());
+    for (NodeId node = 0; node < relabeling.inverse.size(); node++)
+    {
+        ASSERT_EQ(node, relabeling.permutation[relabeling.inverse[node]]);
+    }
+
+    uint64_t edgesCount = 0;
+    for (auto node : graph.getNodeIds())
+    {
+        for (auto neighbor : graph.getNeighborsOf(node))
+        {
+            auto edge = relabeling.graph.findEdge({relabeling.permutation[node], relabeling.permutation[neighbor]});
+            ASSERT_EQ(graph.findEdge({node, neighbor}).weight.value_or(1), edge.weight.value_or(0));
+            edgesCount++;
+        }
+    }
+    ASSERT_EQ(edgesCount, relabeling.graph.edgesAmount());
+}
+
+/* Maximum distance between the ids of adjacent nodes */
+NodeId bandwidth(const CsrGraph& graph) {
+    NodeId width = 0;
+    for (NodeId node = 0; node < graph.nodesAmount(); node++)
+    {
+        for (auto neighbor : graph.neighbors(node))
+        {
+            width = std::max(width, node > neighbor ? node - neighbor : neighbor - node);
+        }
+    }
+    return width;
+}
+
+/* Grid of side x side nodes with shuffled ids */
+CsrGraph shuffledGrid(uint32_t side, uint64_t seed) {
+    std::vector<NodeId> ids(side * side);
+    std::iota(ids.begin(), ids.end(), 0u);
+    std::shuffle(ids.begin(), ids.end(), std::mt19937_64(seed));
+
+    std::vector<EdgeInfo> edges;
+    for (NodeId y = 0; y < side; y++)
+    {
+        for (NodeId x = 0; x < side; x++)
+        {
+            auto node = ids[y * side + x];
+            if (x + 1 < side)
+            {
+                edges.push_back({node, ids[y * side + x + 1]});
+                edges.push_back({ids[y * side + x + 1], node});
+            }
+            if (y + 1 < side)
+            {
+                edges.push_back({node, ids[(y + 1) * side + x]});
+                edges.push_back({ids[(y + 1) * side + x], node});
+            }
+        }
+    }
+    return CsrGraph(side * side, edges);
+}
+} // namespace
+
+class ReorderingTest : public TestWithParam<Ordering>
+{};
+
+TEST_P(ReorderingTest, relabelsAdjListKeepingOriginalIds) {
+    AdjList graph(reorderingLstFile);
+
+    auto relabeling = reorder(graph, GetParam());
+
+    expectRelabeledCopy(graph, relabeling);
+    ASSERT_EQ(Relabeling::noNode, relabeling.permutation[0]);
+}
+
+TEST_P(ReorderingTest, keepsWeightsOfMatrix) {
+    AdjMatrix graph(reorderingMatrixFile);
+
+    auto relabeling = reorder(graph, GetParam());
+
+    ASSERT_TRUE(relabeling.graph.isWeighted());
+    expectRelabeledCopy(graph, relabeling);
+}
+
+TEST_P(ReorderingTest, restoresBfsLevels) {
+    auto graph = Generators::rmat({.scale = 10, .seed = 9});
+    graph.metadata()["name"] = "rmat";
+    auto relabeling = reorder(graph, GetParam());
+    auto expected = std::make_shared<Algorithm::BfsResult>();
+    auto result = std::make_shared<Algorithm::BfsResult>();
+
+    Algorithm::BreadthFirstSearch{expected, 3}(graph);
+    Algorithm::BreadthFirstSearch{result, relabeling.permutation[3]}(relabeling.graph);
+
+    ASSERT_EQ("rmat", relabeling.graph.metadata().at("name"));
+    ASSERT_EQ(expected->levels, relabeling.restore<uint32_t>(result->levels, Algorithm::BfsResult::unreached));
+}
+
+TEST_P(ReorderingTest, handlesEmptyAndEdgelessGraphs) {
+    CsrGraph empty(0, std::vector<EdgeInfo>{});
+    CsrGraph edgeless(4, std::vector<EdgeInfo>{});
+
+    ASSERT_EQ(0, reorder(empty, GetParam()).inverse.size());
+    expectRelabeledCopy(edgeless, reorder(edgeless, GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(Orderings, ReorderingTest, Values(Ordering::degree, Ordering::reverseCuthillMcKee, Ordering::gorder));
+
+TEST(ReorderingOrderTest, sortsByDegree) {
+    auto graph = Generators::rmat({.scale = 9, .seed = 1});
+
+    auto relabeling = reorder(graph, Ordering::degree);
+
+    for (NodeId node = 1; node < relabeling.graph.nodesAmount(); node++)
+    {
+        ASSERT_GE(relabeling.graph.nodeDegree(node - 1), relabeling.graph.nodeDegree(node));
+    }
+}
+
+TEST(ReorderingOrderTest, degreeCountsArcsInBothDirections) {
+    std::vector<EdgeInfo> edges = {
+        {1, 0},
+        {2, 0},
+        {3, 0},
+        {3, 1}
+    };
+    CsrGraph graph(4, edges);
+
+    auto relabeling = reorder(graph, Ordering::degree);
+
+    ASSERT_EQ(std::vector<NodeId>({0, 1, 3, 2}), relabeling.inverse);
+}
+
+TEST(ReorderingOrderTest, reverseCuthillMcKeeRecoversGridBandwidth) {
+    auto graph = shuffledGrid(30, 4);
+
+    auto relabeling = reorder(graph, Ordering::reverseCuthillMcKee);
+
+    ASSERT_GT(bandwidth(graph), 500u);
+    ASSERT_LE(bandwidth(relabeling.graph), 31u);
+}
+
+TEST(ReorderingOrderTest, gorderKeepsGridNeighborsClose) {
+    auto graph = shuffledGrid(30, 5);
+
+    auto relabeling = reorder(graph, Ordering::gorder);
+
+    // edges between nodes at most a window apart, which Gorder packs into shared cache lines
+    auto closeEdges = [](const CsrGraph& ordered) {
+        uint32_t count = 0;
+        for (NodeId node = 0; node < ordered.nodesAmount(); node++)
+        {
+            for (auto neighbor : ordered.neighbors(node))
+            {
+                count += (node > neighbor ? node - neighbor : neighbor - node) <= 5 ? 1 : 0;
+            }
+        }
+        return count;
+    };
+    ASSERT_LT(closeEdges(graph) * 10, closeEdges(relabeling.graph));
+    ASSERT_GT(closeEdges(relabeling.graph), graph.edgesAmount() / 3);
+}
+} // namespace Graphs
@@ -0,0 +1,98 @@
+#include <Graphs/AdjList.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Generators.hpp>
+#include <Graphs/Triangles.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+
+const std::string trianglesListFile = "../test/sample/adjList.lst";
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+bool adjacent(const Graph& graph, NodeId lhs, NodeId rhs) {
+    return graph.findEdge({lhs, rhs}).weight.has_value() or graph.findEdge({rhs, lhs}).weight.has_value();
+}
+
+std::vector<uint64_t> bruteForceTriangles(const Graph& graph) {
+    auto nodeIds = graph.getNodeIds();
+    std::vector<uint64_t> triangles(nodeIds.back() + 1, 0);
+    for (std::size_t i = 0; i < nodeIds.size(); i++)
+    {
+        for (auto j = i + 1; j < nodeIds.size(); j++)
+        {
+            for (auto k = j + 1; k < nodeIds.size(); k++)
+            {
+                if (adjacent(graph, nodeIds[i], nodeIds[j]) and adjacent(graph, nodeIds[j], nodeIds[k])
+                    and adjacent(graph, nodeIds[i], nodeIds[k]))
+                {
+                    triangles[nodeIds[i]]++;
+                    triangles[nodeIds[j]]++;
+                    triangles[nodeIds[k]]++;
+                }
+            }
+        }
+    }
+    return triangles;
+}
+
+CsrGraph completeGraph(uint32_t nodesCount) {
+    std::vector<EdgeInfo> edges;
+    for (NodeId u = 0; u < nodesCount; u++)
+    {
+        for (NodeId v = 0; v < nodesCount; v++)
+        {
+            if (u != v)
+            {
+                edges.push_back({u, v});
+            }
+        }
+    }
+    return CsrGraph(nodesCount, edges);
+}
+} // namespace
+
+TEST(TrianglesTest, completeGraph) {
+    auto graph = completeGraph(20);
+    auto result = std::make_shared<TriangleResult>();
+
+    for (auto kernel : {TriangleCounting::Kernel::merge, TriangleCounting::Kernel::bitmap})
+    {
+        TriangleCounting{result, kernel, 2}(graph);
+        ASSERT_EQ(20 * 19 * 18 / 6, result->triangles);
+        ASSERT_EQ(19 * 18 / 2, result->nodeTriangles[7]);
+        ASSERT_DOUBLE_EQ(1, result->clustering[7]);
+        ASSERT_DOUBLE_EQ(1, result->averageClustering);
+        ASSERT_DOUBLE_EQ(1, result->transitivity);
+    }
+}
+
+TEST(TrianglesTest, matchesBruteForceOnAdjList) {
+    AdjList graph(trianglesListFile);
+    auto expected = bruteForceTriangles(graph);
+    auto result = std::make_shared<TriangleResult>();
+
+    for (auto kernel : {TriangleCounting::Kernel::merge, TriangleCounting::Kernel::bitmap})
+    {
+        TriangleCounting{result, kernel, 3}(graph);
+        ASSERT_EQ(expected, result->nodeTriangles);
+    }
+}
+
+TEST(TrianglesTest, kernelsAgreeOnGeneratedGraph) {
+    auto graph = Generators::rmat({.scale = 11, .edgeFactor = 24, .seed = 6});
+    auto merge = std::make_shared<TriangleResult>();
+    auto bitmap = std::make_shared<TriangleResult>();
+
+    TriangleCounting{merge, TriangleCounting::Kernel::merge, 1}(graph);
+    TriangleCounting{bitmap, TriangleCounting::Kernel::bitmap, 4}(graph);
+
+    ASSERT_GT(merge->triangles, 0);
+    ASSERT_EQ(merge->triangles, bitmap->triangles);
+    ASSERT_EQ(merge->nodeTriangles, bitmap->nodeTriangles);
+    ASSERT_DOUBLE_EQ(merge->transitivity, bitmap->transitivity);
+}
+} // namespace Graphs::Algorithm
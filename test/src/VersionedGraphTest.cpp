@@ -0,0 +1,126 @@
+#include <atomic>
+#include <Graphs/DynamicGraph.hpp>
+#include <Graphs/VersionedGraph.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+namespace Graphs
+{
+TEST(VersionedGraphTest, mutationsAreVisibleAfterPublish) {
+    VersionedGraph graph(DynamicGraph(4));
+    auto reader = graph.reader();
+
+    std::vector<EdgeInfo> edges = {{0, 1}, {1, 2}, {2, 3}};
+    graph.setEdges(edges);
+    ASSERT_EQ(0, reader.read()->graph.edgesAmount());
+
+    ASSERT_EQ(1, graph.publish());
+    ASSERT_EQ(1, graph.publish());
+    auto guard = reader.read();
+    ASSERT_EQ(1, guard->version);
+    ASSERT_EQ(3, guard->graph.edgesAmount());
+    ASSERT_EQ(std::vector<NodeId>({2}), guard->graph.getNeighborsOf(1));
+}
+
+TEST(VersionedGraphTest, retiredSnapshotOutlivesItsReaders) {
+    VersionedGraph graph(DynamicGraph(3));
+    auto reader = graph.reader();
+    {
+        auto guard = reader.read();
+        graph.addNodes(1);
+        graph.publish();
+        graph.removeNode(0);
+        graph.publish();
+
+        ASSERT_EQ(2, graph.retiredAmount());
+        ASSERT_EQ(0, guard->version);
+        ASSERT_EQ(3, guard->graph.nodesAmount());
+    }
+    graph.publish();
+    ASSERT_EQ(0, graph.retiredAmount());
+
+    auto guard = reader.read();
+    ASSERT_EQ(3, guard->graph.nodesAmount());
+    ASSERT_EQ(1, guard->graph.originalId(0));
+}
+
+TEST(VersionedGraphTest, readerSlotsAreLimited) {
+    VersionedGraph graph(DynamicGraph(1), 2);
+    auto first = graph.reader();
+    {
+        auto second = graph.reader();
+        ASSERT_THROW(graph.reader(), std::runtime_error);
+    }
+    ASSERT_NO_THROW(graph.reader());
+}
+
+TEST(VersionedGraphTest, readersSeeConsistentSnapshotsUnderWrites) {
+    constexpr uint32_t nodesCount = 256;
+    constexpr uint32_t readersCount = 4;
+    VersionedGraph graph(DynamicGraph(nodesCount), readersCount);
+
+    std::atomic<bool> done = false;
+    std::atomic<uint32_t> failures = 0;
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0; i < readersCount; i++)
+    {
+        readers.emplace_back([&graph, &done, &failures]() {
+            auto reader = graph.reader();
+            uint64_t lastVersion = 0;
+            while (not done.load())
+            {
+                auto guard = reader.read();
+                // every batch adds both directions of its edges
+                const auto& snapshot = guard->graph;
+                for (NodeId node = 0; node < snapshot.nodesAmount(); node++)
+                {
+                    for (auto neighbor : snapshot.neighbors(node))
+                    {
+                        if (not snapshot.findEdge({neighbor, node}).weight.has_value())
+                        {
+                            failures++;
+                        }
+                    }
+                }
+                if (guard->version < lastVersion)
+                {
+                    failures++;
+                }
+                lastVersion = guard->version;
+            }
+        });
+    }
+
+    for (uint32_t round = 0; round < 200; round++)
+    {
+        std::vector<EdgeInfo> batch;
+        for (NodeId node = 0; node < nodesCount; node += 8)
+        {
+            NodeId neighbor = (node * 7 + round) % nodesCount;
+            batch.push_back({node, neighbor});
+            batch.push_back({neighbor, node});
+        }
+        if (round % 2 == 0)
+        {
+            graph.setEdges(batch);
+        }
+        else
+        {
+            graph.removeEdges(batch);
+        }
+        graph.publish();
+    }
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    graph.publish();
+    ASSERT_EQ(0, failures.load());
+    ASSERT_EQ(0, graph.retiredAmount());
+}
+} // namespace Graphs